@@ -0,0 +1,197 @@
+#include "http_disk_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension_util.hpp"
+
+namespace duckdb {
+
+static constexpr const char *BLOCK_EXTENSION = ".block";
+static constexpr const char *TEMPORARY_EXTENSION = ".tmp";
+
+HTTPDiskCache::HTTPDiskCache(string directory_p, idx_t max_size_p)
+    : fs(FileSystem::CreateLocal()), directory(std::move(directory_p)), max_size(max_size_p), hits(0), misses(0) {
+	if (!fs->DirectoryExists(directory)) {
+		fs->CreateDirectory(directory);
+	}
+	// pick up the blocks cached by earlier runs, and clean up any partially written blocks
+	vector<string> block_names;
+	vector<string> temporary_files;
+	fs->ListFiles(directory, [&](const string &name, bool is_dir) {
+		if (is_dir) {
+			return;
+		}
+		if (StringUtil::EndsWith(name, BLOCK_EXTENSION)) {
+			block_names.push_back(name);
+		} else if (StringUtil::EndsWith(name, TEMPORARY_EXTENSION)) {
+			temporary_files.push_back(name);
+		}
+	});
+	for (auto &name : temporary_files) {
+		fs->RemoveFile(fs->JoinPath(directory, name));
+	}
+	lock_guard<mutex> guard(lock);
+	for (auto &name : block_names) {
+		auto handle = fs->OpenFile(fs->JoinPath(directory, name),
+		                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			continue;
+		}
+		AddBlock(name, NumericCast<idx_t>(fs->GetFileSize(*handle)));
+	}
+	EvictToLimit();
+}
+
+string HTTPDiskCache::GetBlockName(const string &key, idx_t block_idx) const {
+	return StringUtil::Format("%016llx_%llu%s", static_cast<unsigned long long>(Hash(key.c_str())),
+	                          static_cast<unsigned long long>(block_idx), BLOCK_EXTENSION);
+}
+
+bool HTTPDiskCache::ReadBlock(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t block_size) {
+	auto block_name = GetBlockName(key, block_idx);
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = blocks.find(block_name);
+		if (entry == blocks.end() || entry->second.size != block_size) {
+			misses++;
+			return false;
+		}
+		lru_list.splice(lru_list.begin(), lru_list, entry->second.lru_position);
+	}
+	// the block can be evicted (or removed by someone else) after we release the lock - in that case it is a miss
+	auto handle = fs->OpenFile(fs->JoinPath(directory, block_name),
+	                           FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+	if (!handle || NumericCast<idx_t>(fs->GetFileSize(*handle)) != block_size) {
+		lock_guard<mutex> guard(lock);
+		EraseBlock(block_name);
+		misses++;
+		return false;
+	}
+	fs->Read(*handle, buffer, NumericCast<int64_t>(block_size), 0);
+	hits++;
+	return true;
+}
+
+bool HTTPDiskCache::HasBlock(const string &key, idx_t block_idx) {
+	lock_guard<mutex> guard(lock);
+	return blocks.find(GetBlockName(key, block_idx)) != blocks.end();
+}
+
+void HTTPDiskCache::WriteBlock(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size) {
+	if (block_size > max_size) {
+		return;
+	}
+	auto block_name = GetBlockName(key, block_idx);
+	auto block_path = fs->JoinPath(directory, block_name);
+	// write the block to a temporary file first, so readers never observe a partially written block
+	auto temporary_path = block_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + TEMPORARY_EXTENSION;
+	{
+		auto handle = fs->OpenFile(temporary_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		fs->Write(*handle, const_cast<data_ptr_t>(buffer), NumericCast<int64_t>(block_size), 0);
+		handle->Close();
+	}
+	fs->MoveFile(temporary_path, block_path);
+
+	lock_guard<mutex> guard(lock);
+	EraseBlock(block_name);
+	AddBlock(block_name, block_size);
+	EvictToLimit();
+}
+
+void HTTPDiskCache::SetMaxSize(idx_t max_size_p) {
+	lock_guard<mutex> guard(lock);
+	max_size = max_size_p;
+	EvictToLimit();
+}
+
+HTTPDiskCacheStats HTTPDiskCache::GetStats() {
+	lock_guard<mutex> guard(lock);
+	return HTTPDiskCacheStats {hits, misses, blocks.size(), current_size, max_size};
+}
+
+void HTTPDiskCache::AddBlock(const string &block_name, idx_t size) {
+	lru_list.push_front(block_name);
+	blocks[block_name] = CachedBlock {size, lru_list.begin()};
+	current_size += size;
+}
+
+void HTTPDiskCache::EraseBlock(const string &block_name) {
+	auto entry = blocks.find(block_name);
+	if (entry == blocks.end()) {
+		return;
+	}
+	current_size -= entry->second.size;
+	lru_list.erase(entry->second.lru_position);
+	blocks.erase(entry);
+}
+
+void HTTPDiskCache::EvictToLimit() {
+	while (current_size > max_size && !lru_list.empty()) {
+		auto block_name = lru_list.back();
+		EraseBlock(block_name);
+		try {
+			fs->RemoveFile(fs->JoinPath(directory, block_name));
+		} catch (std::exception &) { // NOLINT
+			// the block might have been removed already
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// http_disk_cache_stats
+//===--------------------------------------------------------------------===//
+struct HTTPDiskCacheStatsData : public GlobalTableFunctionState {
+	shared_ptr<HTTPDiskCache> cache;
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> HTTPDiskCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                       vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("directory");
+	return_types.emplace_back(LogicalType::VARCHAR);
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("cached_blocks");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("cached_bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	names.emplace_back("max_size");
+	return_types.emplace_back(LogicalType::UBIGINT);
+	return nullptr;
+}
+
+static unique_ptr<GlobalTableFunctionState> HTTPDiskCacheStatsInit(ClientContext &context,
+                                                                   TableFunctionInitInput &input) {
+	auto result = make_uniq<HTTPDiskCacheStatsData>();
+	result->cache = ObjectCache::GetObjectCache(context).Get<HTTPDiskCache>(HTTPDiskCache::ObjectType());
+	return std::move(result);
+}
+
+static void HTTPDiskCacheStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<HTTPDiskCacheStatsData>();
+	if (data.finished || !data.cache) {
+		return;
+	}
+	auto stats = data.cache->GetStats();
+	idx_t col = 0;
+	output.SetValue(col++, 0, Value(data.cache->GetDirectory()));
+	output.SetValue(col++, 0, Value::UBIGINT(stats.hits));
+	output.SetValue(col++, 0, Value::UBIGINT(stats.misses));
+	output.SetValue(col++, 0, Value::UBIGINT(stats.cached_blocks));
+	output.SetValue(col++, 0, Value::UBIGINT(stats.cached_bytes));
+	output.SetValue(col++, 0, Value::UBIGINT(stats.max_size));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void HTTPDiskCache::RegisterFunctions(DatabaseInstance &instance) {
+	TableFunction stats_function("http_disk_cache_stats", {}, HTTPDiskCacheStatsFunction, HTTPDiskCacheStatsBind,
+	                             HTTPDiskCacheStatsInit);
+	ExtensionUtil::RegisterFunction(instance, stats_function);
+}
+
+} // namespace duckdb
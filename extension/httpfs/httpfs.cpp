@@ -59,6 +59,11 @@ HTTPParams HTTPParams::ReadFrom(optional_ptr<FileOpener> opener, optional_ptr<Fi
 	                                 info);
 	FileOpener::TryGetCurrentSetting(opener, "ca_cert_file", result.ca_cert_file, info);
 	FileOpener::TryGetCurrentSetting(opener, "hf_max_per_page", result.hf_max_per_page, info);
+	FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_directory", result.disk_cache_directory, info);
+	string disk_cache_max_size;
+	if (FileOpener::TryGetCurrentSetting(opener, "http_disk_cache_max_size", disk_cache_max_size, info)) {
+		result.disk_cache_max_size = DBConfig::ParseMemoryLimit(disk_cache_max_size);
+	}
 
 	// HTTP Secret lookups
 	KeyValueSecretReader settings_reader(*opener, info, "http");
@@ -439,8 +444,8 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, const string &path, FileOpenFlags flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, FileOpenFlags flags,
@@ -512,7 +517,11 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	// Don't buffer when DirectIO is set or when we are doing parallel reads
 	bool skip_buffer = hfh.flags.DirectIO() || hfh.flags.RequireParallelAccess();
 	if (skip_buffer && to_read > 0) {
-		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
+		ReadRange(hfh, location, (char *)buffer, to_read);
+		if (hfh.flags.RequireParallelAccess()) {
+			// positional reads can run concurrently, so we don't touch the (shared) read position
+			return;
+		}
 		hfh.buffer_available = 0;
 		hfh.buffer_idx = 0;
 		hfh.file_offset = location + nr_bytes;
@@ -548,14 +557,13 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 
 			// Bypass buffer if we read more than buffer size
 			if (to_read > new_buffer_available) {
-				GetRangeRequest(hfh, hfh.path, {}, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
+				ReadRange(hfh, location + buffer_offset, (char *)buffer + buffer_offset, to_read);
 				hfh.buffer_available = 0;
 				hfh.buffer_idx = 0;
 				hfh.file_offset += to_read;
 				break;
 			} else {
-				GetRangeRequest(hfh, hfh.path, {}, hfh.file_offset, (char *)hfh.read_buffer.get(),
-				                new_buffer_available);
+				ReadRange(hfh, hfh.file_offset, (char *)hfh.read_buffer.get(), new_buffer_available);
 				hfh.buffer_available = new_buffer_available;
 				hfh.buffer_idx = 0;
 				hfh.buffer_start = hfh.file_offset;
@@ -565,6 +573,53 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+void HTTPFileSystem::ReadRange(HTTPFileHandle &hfh, idx_t file_offset, char *buffer_out, idx_t buffer_out_len) {
+	auto cache_key = hfh.disk_cache ? hfh.GetDiskCacheKey() : string();
+	if (cache_key.empty() || buffer_out_len == 0) {
+		GetRangeRequest(hfh, hfh.path, {}, file_offset, buffer_out, buffer_out_len);
+		return;
+	}
+	auto &disk_cache = *hfh.disk_cache;
+	const auto block_size = HTTPDiskCache::BLOCK_SIZE;
+	const auto range_end = file_offset + buffer_out_len;
+
+	// copies the part of [start, start + len) that overlaps with the requested range to the output buffer
+	auto copy_overlap = [&](const_data_ptr_t data, idx_t start, idx_t len) {
+		auto copy_start = MaxValue<idx_t>(start, file_offset);
+		auto copy_end = MinValue<idx_t>(start + len, range_end);
+		memcpy(buffer_out + (copy_start - file_offset), data + (copy_start - start), copy_end - copy_start);
+	};
+
+	auto block_buffer = make_unsafe_uniq_array<data_t>(block_size);
+	auto last_block = (range_end - 1) / block_size;
+	auto block_idx = file_offset / block_size;
+	while (block_idx <= last_block) {
+		auto block_start = block_idx * block_size;
+		auto block_len = MinValue<idx_t>(block_size, hfh.length - block_start);
+		if (disk_cache.ReadBlock(cache_key, block_idx, block_buffer.get(), block_len)) {
+			copy_overlap(block_buffer.get(), block_start, block_len);
+			block_idx++;
+			continue;
+		}
+		// fetch this block together with the following blocks that are not cached in a single request
+		auto end_block = block_idx + 1;
+		while (end_block <= last_block && !disk_cache.HasBlock(cache_key, end_block)) {
+			end_block++;
+		}
+		auto fetch_end = MinValue<idx_t>(end_block * block_size, hfh.length);
+		auto fetch_len = fetch_end - block_start;
+		auto fetch_buffer = make_unsafe_uniq_array<data_t>(fetch_len);
+		GetRangeRequest(hfh, hfh.path, {}, block_start, char_ptr_cast(fetch_buffer.get()), fetch_len);
+		for (idx_t fetched_block = block_idx; fetched_block < end_block; fetched_block++) {
+			auto offset = (fetched_block - block_idx) * block_size;
+			disk_cache.WriteBlock(cache_key, fetched_block, fetch_buffer.get() + offset,
+			                      MinValue<idx_t>(block_size, fetch_len - offset));
+		}
+		copy_overlap(fetch_buffer.get(), block_start, fetch_len);
+		block_idx = end_block;
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -632,6 +687,40 @@ optional_ptr<HTTPMetadataCache> HTTPFileSystem::GetGlobalCache() {
 	return global_metadata_cache.get();
 }
 
+// Get the disk cache for remote files if it is enabled
+static shared_ptr<HTTPDiskCache> TryGetDiskCache(optional_ptr<FileOpener> opener, const HTTPParams &params) {
+	if (params.disk_cache_directory.empty()) {
+		return nullptr;
+	}
+	auto db = FileOpener::TryGetDatabase(opener);
+	if (!db) {
+		return nullptr;
+	}
+	auto &object_cache = db->GetObjectCache();
+	auto disk_cache = object_cache.GetOrCreate<HTTPDiskCache>(HTTPDiskCache::ObjectType(), params.disk_cache_directory,
+	                                                          params.disk_cache_max_size);
+	if (!disk_cache) {
+		return nullptr;
+	}
+	if (disk_cache->GetDirectory() != params.disk_cache_directory) {
+		// the cache directory was changed
+		disk_cache = make_shared_ptr<HTTPDiskCache>(params.disk_cache_directory, params.disk_cache_max_size);
+		object_cache.Put(HTTPDiskCache::ObjectType(), disk_cache);
+	}
+	disk_cache->SetMaxSize(params.disk_cache_max_size);
+	return disk_cache;
+}
+
+string HTTPFileHandle::GetDiskCacheKey() const {
+	if (!etag.empty()) {
+		return path + "#" + etag;
+	}
+	if (last_modified != 0) {
+		return path + "#" + to_string(length) + "-" + to_string(last_modified);
+	}
+	return string();
+}
+
 // Get either the local, global, or no cache depending on settings
 static optional_ptr<HTTPMetadataCache> TryGetMetadataCache(optional_ptr<FileOpener> opener, HTTPFileSystem &httpfs) {
 	auto db = FileOpener::TryGetDatabase(opener);
@@ -662,6 +751,9 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 	}
 
 	auto current_cache = TryGetMetadataCache(opener, hfs);
+	if (!http_params.force_download && flags.OpenForReading() && !flags.OpenForWriting()) {
+		disk_cache = TryGetDiskCache(opener, http_params);
+	}
 
 	bool should_write_cache = false;
 	if (!http_params.force_download && current_cache && !flags.OpenForWriting()) {
@@ -672,6 +764,7 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags.OpenForReading()) {
 				read_buffer = duckdb::unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
@@ -782,8 +875,10 @@ void HTTPFileHandle::Initialize(optional_ptr<FileOpener> opener) {
 		last_modified = mktime(&tm);
 	}
 
+	etag = res->headers["ETag"];
+
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
 	}
 }
 
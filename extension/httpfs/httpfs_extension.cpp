@@ -39,6 +39,11 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption("ca_cert_file", "Path to a custom certificate file for self-signed certificates.",
 	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_disk_cache_directory",
+	                          "Directory of the local disk cache for remote files (empty: the disk cache is disabled)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_disk_cache_max_size", "Maximum size of the local disk cache for remote files",
+	                          LogicalType::VARCHAR, Value("1GB"));
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR, Value("us-east-1"));
 	config.AddExtensionOption("s3_access_key_id", "S3 Access Key ID", LogicalType::VARCHAR);
@@ -65,6 +70,7 @@ static void LoadInternal(DatabaseInstance &instance) {
 	auto provider = make_uniq<AWSEnvironmentCredentialsProvider>(config);
 	provider->SetAll();
 
+	HTTPDiskCache::RegisterFunctions(instance);
 	CreateS3SecretFunctions::Register(instance);
 	CreateBearerTokenFunctions::Register(instance);
 
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+struct HTTPDiskCacheStats {
+	idx_t hits;
+	idx_t misses;
+	idx_t cached_blocks;
+	idx_t cached_bytes;
+	idx_t max_size;
+};
+
+//! Persistent cache of the contents of remote files on the local disk
+//! Files are cached in blocks of BLOCK_SIZE bytes, which are stored as separate files in the cache directory. The
+//! blocks are keyed by the URL and the version of the file (ETag or size and last modification time), so a new version
+//! of a file never reads stale blocks. Blocks are evicted in LRU order once the cache exceeds its maximum size.
+class HTTPDiskCache : public ObjectCacheEntry {
+public:
+	static constexpr idx_t BLOCK_SIZE = 1ULL << 20ULL;
+
+public:
+	HTTPDiskCache(string directory, idx_t max_size);
+
+	//! Reads the block into the buffer, returns false if the block is not in the cache
+	bool ReadBlock(const string &key, idx_t block_idx, data_ptr_t buffer, idx_t block_size);
+	//! Whether or not the block is in the cache (does not count as a hit or miss)
+	bool HasBlock(const string &key, idx_t block_idx);
+	//! Adds the block to the cache, evicting the least recently used blocks if the cache is full
+	void WriteBlock(const string &key, idx_t block_idx, const_data_ptr_t buffer, idx_t block_size);
+
+	void SetMaxSize(idx_t max_size);
+	const string &GetDirectory() const {
+		return directory;
+	}
+	HTTPDiskCacheStats GetStats();
+
+	static void RegisterFunctions(DatabaseInstance &instance);
+
+public:
+	static string ObjectType() {
+		return "http_disk_cache";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CachedBlock {
+		idx_t size;
+		list<string>::iterator lru_position;
+	};
+
+	string GetBlockName(const string &key, idx_t block_idx) const;
+	void AddBlock(const string &block_name, idx_t size);
+	void EraseBlock(const string &block_name);
+	void EvictToLimit();
+
+private:
+	//! The local file system the blocks are stored in
+	unique_ptr<FileSystem> fs;
+	string directory;
+
+	mutex lock;
+	//! The cached blocks by file name
+	unordered_map<string, CachedBlock> blocks;
+	//! The names of the cached blocks, from most to least recently used
+	list<string> lru_list;
+	idx_t current_size = 0;
+	idx_t max_size;
+
+	atomic<idx_t> hits;
+	atomic<idx_t> misses;
+};
+
+} // namespace duckdb
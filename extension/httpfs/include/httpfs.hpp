@@ -7,6 +7,7 @@
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "http_metadata_cache.hpp"
+#include "http_disk_cache.hpp"
 
 namespace duckdb_httplib_openssl {
 struct Response;
@@ -45,6 +46,7 @@ struct HTTPParams {
 	static constexpr bool DEFAULT_KEEP_ALIVE = true;
 	static constexpr bool DEFAULT_ENABLE_SERVER_CERT_VERIFICATION = false;
 	static constexpr uint64_t DEFAULT_HF_MAX_PER_PAGE = 0;
+	static constexpr idx_t DEFAULT_DISK_CACHE_MAX_SIZE = 1000000000; // 1GB
 
 	uint64_t timeout = DEFAULT_TIMEOUT;
 	uint64_t retries = DEFAULT_RETRIES;
@@ -54,6 +56,9 @@ struct HTTPParams {
 	bool keep_alive = DEFAULT_KEEP_ALIVE;
 	bool enable_server_cert_verification = DEFAULT_ENABLE_SERVER_CERT_VERIFICATION;
 	idx_t hf_max_per_page = DEFAULT_HF_MAX_PER_PAGE;
+	//! The directory of the local disk cache for remote files (empty: disabled)
+	string disk_cache_directory;
+	idx_t disk_cache_max_size = DEFAULT_DISK_CACHE_MAX_SIZE;
 
 	string ca_cert_file;
 	string http_proxy;
@@ -98,6 +103,10 @@ public:
 	FileOpenFlags flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
+
+	// When the disk cache is enabled, ranges are read through the disk cache
+	shared_ptr<HTTPDiskCache> disk_cache;
 
 	// When using full file download, the full file will be written to a cached file handle
 	unique_ptr<CachedFileHandle> cached_file_handle;
@@ -116,6 +125,8 @@ public:
 	shared_ptr<HTTPState> state;
 
 	void AddHeaders(HeaderMap &map);
+	//! The key of the file in the disk cache, empty if the version of the file can not be identified
+	string GetDiskCacheKey() const;
 
 	// Get a Client to run requests over
 	unique_ptr<duckdb_httplib_openssl::Client> GetClient(optional_ptr<ClientContext> client_context);
@@ -196,6 +207,9 @@ protected:
 	virtual duckdb::unique_ptr<HTTPFileHandle> CreateHandle(const string &path, FileOpenFlags flags,
 	                                                        optional_ptr<FileOpener> opener);
 
+	//! Reads a range of the file, through the disk cache if it is enabled
+	void ReadRange(HTTPFileHandle &handle, idx_t file_offset, char *buffer_out, idx_t buffer_out_len);
+
 	static duckdb::unique_ptr<ResponseWrapper>
 	RunRequestWithRetry(const std::function<duckdb_httplib_openssl::Result(void)> &request, string &url, string method,
 	                    const HTTPParams &params, const std::function<void(void)> &retry_cb = {});
@@ -1,6 +1,8 @@
 #include "buffered_json_reader.hpp"
 
+#include "duckdb/common/compressed_file_system.hpp"
 #include "duckdb/common/file_opener.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 
@@ -203,6 +205,11 @@ void BufferedJSONReader::OpenJSONFile() {
 	if (!IsOpen()) {
 		auto &fs = FileSystem::GetFileSystem(context);
 		auto regular_file_handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ | options.compression);
+		if (regular_file_handle->GetFileCompressionType() != FileCompressionType::UNCOMPRESSED &&
+		    TaskScheduler::GetScheduler(context).NumberOfThreads() > 1) {
+			// compressed files can only be read sequentially, overlap their decompression with parsing
+			regular_file_handle->Cast<CompressedFile>().EnableReadAhead();
+		}
 		file_handle = make_uniq<JSONFileHandle>(std::move(regular_file_handle), BufferAllocator::Get(context));
 	}
 	Reset();
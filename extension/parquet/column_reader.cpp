@@ -10,6 +10,7 @@
 #include "lz4.hpp"
 #include "miniz_wrapper.hpp"
 #include "null_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_decimal_utils.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_timestamp.hpp"
@@ -188,6 +189,66 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const vect
 	return ParquetStatisticsUtils::TransformColumnStatistics(*this, columns);
 }
 
+unique_ptr<BaseStatistics> ColumnReader::PageStats(const ColumnIndex &column_index, idx_t page_idx) {
+	if (HasRepeats()) {
+		// pages of repeated columns do not start at row boundaries
+		return nullptr;
+	}
+	return ParquetStatisticsUtils::TransformPageStatistics(*this, column_index, page_idx);
+}
+
+bool ColumnReader::BloomFilterHash(const Value &constant, uint64_t &result) {
+	if (HasRepeats() || constant.IsNull() || constant.type() != Type()) {
+		return false;
+	}
+	// the Bloom filter contains the hashes of the plain encoded physical values
+	switch (Schema().type) {
+	case Type::INT32:
+		switch (Type().id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+			result = ParquetBloomFilter::Hash<int32_t>(constant.GetValue<int32_t>());
+			return true;
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			result = ParquetBloomFilter::Hash<uint32_t>(constant.GetValue<uint32_t>());
+			return true;
+		case LogicalTypeId::DATE:
+			result = ParquetBloomFilter::Hash<int32_t>(constant.GetValue<date_t>().days);
+			return true;
+		default:
+			return false;
+		}
+	case Type::INT64:
+		switch (Type().id()) {
+		case LogicalTypeId::BIGINT:
+			result = ParquetBloomFilter::Hash<int64_t>(constant.GetValue<int64_t>());
+			return true;
+		case LogicalTypeId::UBIGINT:
+			result = ParquetBloomFilter::Hash<uint64_t>(constant.GetValue<uint64_t>());
+			return true;
+		default:
+			return false;
+		}
+	case Type::BYTE_ARRAY:
+		switch (Type().id()) {
+		case LogicalTypeId::VARCHAR:
+		case LogicalTypeId::BLOB: {
+			auto &str = StringValue::Get(constant);
+			result = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+			return true;
+		}
+		default:
+			return false;
+		}
+	default:
+		// floating point values are not looked up: -0.0 and 0.0 compare equal but hash differently
+		return false;
+	}
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -238,9 +299,12 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	offset_index.reset();
+	// skips do not carry over to the next row group
+	pending_skips = 0;
 }
 
-void ColumnReader::PrepareRead(parquet_filter_t &filter) {
+idx_t ColumnReader::PrepareRead(parquet_filter_t &filter, idx_t skippable_rows) {
 	dict_decoder.reset();
 	defined_decoder.reset();
 	bss_decoder.reset();
@@ -248,6 +312,22 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 	PageHeader page_hdr;
 	reader.Read(page_hdr, *protocol);
 
+	if (skippable_rows > 0 && !HasRepeats() && !reader.parquet_options.encryption_config) {
+		// without repeats every value is a row - check if we need any of the rows of this page
+		int64_t page_rows = -1;
+		if (page_hdr.type == PageType::DATA_PAGE) {
+			page_rows = page_hdr.data_page_header.num_values;
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2) {
+			page_rows = page_hdr.data_page_header_v2.num_values;
+		}
+		if (page_rows > 0 && NumericCast<idx_t>(page_rows) <= skippable_rows) {
+			auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+			trans.SetLocation(trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size));
+			ResetPage();
+			return NumericCast<idx_t>(page_rows);
+		}
+	}
+
 	switch (page_hdr.type) {
 	case PageType::DATA_PAGE_V2:
 		PreparePageV2(page_hdr);
@@ -265,6 +345,7 @@ void ColumnReader::PrepareRead(parquet_filter_t &filter) {
 		break; // ignore INDEX page type and any other custom extensions
 	}
 	ResetPage();
+	return 0;
 }
 
 void ColumnReader::ResetPage() {
@@ -482,27 +563,50 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 	}
 }
 
+// the number of consecutive rows starting at offset that are filtered out
+static idx_t FilteredRowCount(const parquet_filter_t &filter, idx_t offset, idx_t count) {
+	if (filter.none()) {
+		return count;
+	}
+	idx_t result = 0;
+	while (result < count && !filter.test(offset + result)) {
+		result++;
+	}
+	return result;
+}
+
 idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
                          Vector &result) {
-	// we need to reset the location because multiple column readers share the same protocol
-	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
-	trans.SetLocation(chunk_read_offset);
-
 	// Perform any skips that were not applied yet.
 	if (pending_skips > 0) {
 		ApplyPendingSkips(pending_skips);
 	}
 
+	// we need to reset the location because multiple column readers share the same protocol
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+
 	idx_t result_offset = 0;
 	auto to_read = num_values;
 
 	while (to_read > 0) {
-		while (page_rows_available == 0) {
-			PrepareRead(filter);
+		while (page_rows_available == 0 && to_read > 0) {
+			// data pages of which none of the rows pass the filter are skipped without decompressing them
+			auto skipped = PrepareRead(filter, HasRepeats() ? 0 : FilteredRowCount(filter, result_offset, to_read));
+			if (skipped > 0 && HasDefines()) {
+				memset(define_out + result_offset, 0, skipped);
+			}
+			result_offset += skipped;
+			to_read -= skipped;
+		}
+		if (to_read == 0) {
+			break;
 		}
 
 		D_ASSERT(block);
 		auto read_now = MinValue<idx_t>(to_read, page_rows_available);
+		// if none of the rows pass the filter we only have to advance the decoders
+		bool skip_values = FilteredRowCount(filter, result_offset, read_now) == read_now;
 
 		D_ASSERT(read_now <= STANDARD_VECTOR_SIZE);
 
@@ -527,7 +631,9 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 			}
 		}
 
-		if (dict_decoder) {
+		if (dict_decoder && skip_values) {
+			dict_decoder->Skip(NumericCast<uint32_t>(read_now - null_count));
+		} else if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
 			DictReference(result);
@@ -553,6 +659,8 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 			}
 			// Plain() will put NULLs in the right place
 			Plain(read_buf, define_out, read_now, filter, result_offset, result);
+		} else if (rle_decoder && skip_values) {
+			rle_decoder->Skip(NumericCast<uint32_t>(read_now - null_count));
 		} else if (rle_decoder) {
 			// RLE encoding for boolean
 			D_ASSERT(type.id() == LogicalTypeId::BOOLEAN);
@@ -564,6 +672,12 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		} else if (byte_array_data) {
 			// DELTA_BYTE_ARRAY or DELTA_LENGTH_BYTE_ARRAY
 			DeltaByteArray(define_out, read_now, filter, result_offset, result);
+		} else if (bss_decoder && skip_values) {
+			if (schema.type == duckdb_parquet::format::Type::FLOAT) {
+				bss_decoder->Skip<float>(NumericCast<uint32_t>(read_now - null_count));
+			} else {
+				bss_decoder->Skip<double>(NumericCast<uint32_t>(read_now - null_count));
+			}
 		} else if (bss_decoder) {
 			auto read_buf = make_shared_ptr<ResizeableBuffer>();
 
@@ -613,7 +727,31 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	idx_t read = 0;
 
 	while (remaining) {
+		if (page_rows_available == 0) {
+			// we are at a page boundary: try to skip over entire pages without decompressing them
+			auto skipped = SkipPages(remaining);
+			read += skipped;
+			remaining -= skipped;
+			if (remaining == 0) {
+				break;
+			}
+			if (page_rows_available == 0 && !HasRepeats()) {
+				// without an offset index we can still skip the next page after reading its header
+				auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+				trans.SetLocation(chunk_read_offset);
+				skipped = PrepareRead(none_filter, remaining);
+				chunk_read_offset = trans.GetLocation();
+				group_rows_available -= skipped;
+				read += skipped;
+				remaining -= skipped;
+				continue;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		if (page_rows_available > 0) {
+			// stop at the end of the current page, so we can skip the next pages entirely
+			to_read = MinValue<idx_t>(to_read, page_rows_available);
+		}
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
@@ -623,6 +761,60 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	}
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(page_rows_available == 0);
+	if (HasRepeats() || !chunk || !chunk->__isset.offset_index_offset) {
+		// we can only map rows to pages for non-repeated columns with an offset index
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (!offset_index) {
+		offset_index = make_uniq<OffsetIndex>();
+		trans.SetLocation(UnsafeNumericCast<idx_t>(chunk->offset_index_offset));
+		reader.Read(*offset_index, *protocol);
+	}
+	auto &page_locations = offset_index->page_locations;
+	if (page_locations.empty()) {
+		return 0;
+	}
+	if (chunk_read_offset < UnsafeNumericCast<idx_t>(page_locations[0].offset)) {
+		// the dictionary page precedes the first data page - we need to read it before skipping any data pages
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+		if (page_rows_available > 0) {
+			// this was not a dictionary page after all
+			return 0;
+		}
+	}
+	// find the page we are currently positioned at
+	auto current_row = UnsafeNumericCast<int64_t>(chunk->meta_data.num_values - group_rows_available);
+	auto entry = std::lower_bound(
+	    page_locations.begin(), page_locations.end(), current_row,
+	    [](const duckdb_parquet::format::PageLocation &location, int64_t row) { return location.first_row_index < row; });
+	if (entry == page_locations.end() || entry->first_row_index != current_row ||
+	    UnsafeNumericCast<idx_t>(entry->offset) != chunk_read_offset) {
+		// we are not positioned at the start of a page from the offset index
+		return 0;
+	}
+	auto target_row = current_row + UnsafeNumericCast<int64_t>(num_values);
+	auto page_idx = NumericCast<idx_t>(entry - page_locations.begin());
+	idx_t skipped = 0;
+	for (; page_idx < page_locations.size(); page_idx++) {
+		auto &location = page_locations[page_idx];
+		auto page_end = page_idx + 1 < page_locations.size() ? page_locations[page_idx + 1].first_row_index
+		                                                       : chunk->meta_data.num_values;
+		if (page_end > target_row) {
+			// we need (part of) this page
+			break;
+		}
+		skipped += NumericCast<idx_t>(page_end - location.first_row_index);
+		chunk_read_offset = UnsafeNumericCast<idx_t>(location.offset) + NumericCast<idx_t>(location.compressed_page_size);
+	}
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 //===--------------------------------------------------------------------===//
 // String Column Reader
 //===--------------------------------------------------------------------===//
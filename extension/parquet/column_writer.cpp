@@ -1,6 +1,9 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -355,6 +358,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The Bloom filter of the column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -417,6 +422,15 @@ protected:
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
 
+	//! Whether this writer can write a Bloom filter for its values. Only used for scalar types.
+	virtual bool SupportsBloomFilter() const {
+		return false;
+	}
+	//! Inserts the hashes of the (plain encoded) values of a vector into the Bloom filter of the column chunk
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t count) {
+		throw InternalException("This writer does not support Bloom filters");
+	}
+
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
 	}
@@ -495,6 +509,12 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (max_repeat == 0 && schema_path.size() == 1 && SupportsBloomFilter() && writer.HasBloomFilter(schema_path[0])) {
+		auto &column_chunk = state.row_group.columns[state.col_idx];
+		auto num_distinct = HasDictionary(state) ? DictionarySize(state)
+		                                         : NumericCast<idx_t>(column_chunk.meta_data.num_values) - state.null_count;
+		state.bloom_filter = make_uniq<ParquetBloomFilter>(num_distinct, writer.BloomFilterFalsePositiveRatio());
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -622,6 +642,9 @@ idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
 
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (state.bloom_filter) {
+		UpdateBloomFilter(state, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -728,6 +751,19 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	// the Bloom filter is written after the pages, and is not part of the column chunk
+	if (state.bloom_filter) {
+		auto bloom_filter_offset = column_writer.GetTotalWritten();
+		ParquetBloomFilterHeader header;
+		header.num_bytes = NumericCast<int32_t>(state.bloom_filter->SizeInBytes());
+		writer.Write(header);
+		writer.WriteData(state.bloom_filter->Data(), state.bloom_filter->SizeInBytes());
+		column_chunk.meta_data.__set_bloom_filter_offset(UnsafeNumericCast<int64_t>(bloom_filter_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
+		state.bloom_filter.reset();
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -900,6 +936,39 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, cons
 	ser.WriteData(const_data_ptr_cast(write_combiner), write_combiner_count * sizeof(TGT));
 }
 
+template <class TGT>
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	//! The encoding of the data pages
+	Encoding::type encoding = Encoding::PLAIN;
+
+	// analysis state (only used for integers in AUTO mode)
+	idx_t estimated_plain_size = 0;
+	idx_t estimated_delta_size = 0;
+	//! The deltas of the current miniblock, the delta encoding is estimated one miniblock at a time
+	TGT previous_value = 0;
+	bool has_previous_value = false;
+	TGT min_delta = 0;
+	TGT max_delta = 0;
+	idx_t miniblock_count = 0;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	explicit StandardWriterPageState(Encoding::type encoding) : encoding(encoding) {
+	}
+
+	Encoding::type encoding;
+	//! The (non-NULL) values of the page, these are encoded when the page is flushed
+	unsafe_vector<TGT> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -914,15 +983,177 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState<TGT>>(row_group, row_group.columns.size());
+		switch (writer.GetEncodingMode()) {
+		case ParquetEncodingMode::DELTA_BINARY_PACKED:
+			result->encoding = SupportsDeltaEncoding() ? Encoding::DELTA_BINARY_PACKED : Encoding::PLAIN;
+			break;
+		case ParquetEncodingMode::BYTE_STREAM_SPLIT:
+			result->encoding = SupportsByteStreamSplit() ? Encoding::BYTE_STREAM_SPLIT : Encoding::PLAIN;
+			break;
+		case ParquetEncodingMode::AUTO:
+			// byte stream split does not make the data smaller by itself, but makes floats far more compressible
+			// integers are delta encoded if the analysis shows that this pays off
+			result->encoding = SupportsByteStreamSplit() && writer.GetCodec() != CompressionCodec::UNCOMPRESSED
+			                       ? Encoding::BYTE_STREAM_SPLIT
+			                       : Encoding::PLAIN;
+			break;
+		default:
+			result->encoding = Encoding::PLAIN;
+			break;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		return SupportsDeltaEncoding() && writer.GetEncodingMode() == ParquetEncodingMode::AUTO;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		AnalyzeDeltas(state, vector, count, std::is_integral<TGT>());
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		if (state.miniblock_count > 0) {
+			FinalizeMiniblockEstimate(state, std::is_integral<TGT>());
+		}
+		// decoding deltas is more expensive than reading plain values, so we only use the delta encoding if it
+		// saves at least a quarter of the size
+		if (state.estimated_plain_size > 0 && state.estimated_delta_size * 4 <= state.estimated_plain_size * 3) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		return state.encoding;
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		if (state.encoding == Encoding::PLAIN) {
+			// plain values are written directly into the page
+			return nullptr;
+		}
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding);
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		if (!state_p) {
+			return;
+		}
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		EncodePage(temp_writer, page_state, std::is_floating_point<TGT>());
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state_p) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+			page_state.values.push_back(target_value);
+		}
+	}
+
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash<TGT>(target_value));
+		}
 	}
 
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
+
+private:
+	static constexpr bool SupportsDeltaEncoding() {
+		return std::is_integral<TGT>::value;
+	}
+	static constexpr bool SupportsByteStreamSplit() {
+		return std::is_floating_point<TGT>::value;
+	}
+
+	//! Estimates the size of the DELTA_BINARY_PACKED encoding of the values
+	void AnalyzeDeltas(StandardColumnWriterState<TGT> &state, Vector &vector, idx_t count, std::true_type) {
+		using UNSIGNED = typename std::make_unsigned<TGT>::type;
+		auto &mask = FlatVector::Validity(vector);
+		const auto *ptr = FlatVector::GetData<SRC>(vector);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			state.estimated_plain_size += sizeof(TGT);
+			if (!state.has_previous_value) {
+				state.has_previous_value = true;
+				state.previous_value = target_value;
+				continue;
+			}
+			auto delta = TGT(UNSIGNED(target_value) - UNSIGNED(state.previous_value));
+			state.previous_value = target_value;
+			if (state.miniblock_count == 0) {
+				state.min_delta = delta;
+				state.max_delta = delta;
+			} else {
+				state.min_delta = MinValue(state.min_delta, delta);
+				state.max_delta = MaxValue(state.max_delta, delta);
+			}
+			if (++state.miniblock_count == DbpEncoder::VALUES_PER_MINIBLOCK) {
+				FinalizeMiniblockEstimate(state, std::true_type());
+			}
+		}
+	}
+	void AnalyzeDeltas(StandardColumnWriterState<TGT> &state, Vector &vector, idx_t count, std::false_type) {
+		throw InternalException("Only integers can be delta encoded");
+	}
+
+	static void FinalizeMiniblockEstimate(StandardColumnWriterState<TGT> &state, std::true_type) {
+		using UNSIGNED = typename std::make_unsigned<TGT>::type;
+		auto bit_width = DbpEncoder::BitWidth(UNSIGNED(UNSIGNED(state.max_delta) - UNSIGNED(state.min_delta)));
+		// the bit-packed deltas, plus the bit width and (a share of) the minimum delta of the block
+		state.estimated_delta_size += DbpEncoder::VALUES_PER_MINIBLOCK * bit_width / 8 + 2;
+		state.miniblock_count = 0;
+	}
+	static void FinalizeMiniblockEstimate(StandardColumnWriterState<TGT> &state, std::false_type) {
+		throw InternalException("Only integers can be delta encoded");
+	}
+
+	static void EncodePage(WriteStream &temp_writer, StandardWriterPageState<TGT> &page_state, std::true_type) {
+		D_ASSERT(page_state.encoding == Encoding::BYTE_STREAM_SPLIT);
+		BssEncoder::Encode<TGT>(temp_writer, page_state.values.data(), page_state.values.size());
+	}
+
+	static void EncodePage(WriteStream &temp_writer, StandardWriterPageState<TGT> &page_state, std::false_type) {
+		D_ASSERT(page_state.encoding == Encoding::DELTA_BINARY_PACKED);
+		// unsigned types are delta encoded as the signed type of the same width
+		using SIGNED = typename std::make_signed<TGT>::type;
+		DbpEncoder::Encode<SIGNED>(temp_writer, reinterpret_cast<const SIGNED *>(page_state.values.data()),
+		                           page_state.values.size());
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -1321,10 +1552,17 @@ public:
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
 
+	// delta analysis state (only used in AUTO mode)
+	idx_t total_string_size = 0;
+	idx_t shared_prefix_size = 0;
+	string last_analyzed_value;
+
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
-	// key_bit_width== 0 signifies the chunk is written in plain encoding
+	// key_bit_width== 0 signifies the chunk is written in plain (or delta) encoding
 	uint32_t key_bit_width;
+	// whether the chunk is written in DELTA_BYTE_ARRAY encoding
+	bool delta_encoded = false;
 
 	bool IsDictionaryEncoded() const {
 		return key_bit_width != 0;
@@ -1333,19 +1571,28 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool delta_encoded)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false),
+	      delta_encoded(delta_encoded) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
+		D_ASSERT(!IsDictionaryEncoded() || !delta_encoded);
 	}
 
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	// if 0, we're writing a plain (or delta) page
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	// DELTA_BYTE_ARRAY: the prefix and suffix lengths are written before the suffixes when the page is flushed
+	bool delta_encoded;
+	unsafe_vector<int32_t> prefix_lengths;
+	unsafe_vector<int32_t> suffix_lengths;
+	MemoryStream suffixes;
+	string previous_value;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1373,7 +1620,10 @@ public:
 
 	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		if (writer.DictionaryCompressionRatioThreshold() == NumericLimits<double>::Maximum() ||
+		if (writer.GetEncodingMode() == ParquetEncodingMode::AUTO) {
+			AnalyzeSharedPrefixes(state, vector, count);
+		}
+		if (!UsesDictionaryEncoding() || writer.DictionaryCompressionRatioThreshold() == NumericLimits<double>::Maximum() ||
 		    (state.dictionary.size() > DICTIONARY_ANALYZE_THRESHOLD && WontUseDictionary(state))) {
 			// Early out: compression ratio is less than the specified parameter
 			// after seeing more entries than the threshold
@@ -1427,13 +1677,26 @@ public:
 
 		// check if a dictionary will require more space than a plain write, or if the dictionary page is going to
 		// be too large
-		if (WontUseDictionary(state)) {
+		if (!UsesDictionaryEncoding() || WontUseDictionary(state)) {
 			// clearing the dictionary signals a plain write
 			state.dictionary.clear();
 			state.key_bit_width = 0;
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
 		}
+		switch (writer.GetEncodingMode()) {
+		case ParquetEncodingMode::DELTA_BYTE_ARRAY:
+			state.delta_encoded = true;
+			break;
+		case ParquetEncodingMode::AUTO:
+			// strings that share a substantial prefix with the previous string are delta encoded
+			state.delta_encoded = !state.IsDictionaryEncoded() && state.total_string_size > 0 &&
+			                      state.shared_prefix_size * 4 >= state.total_string_size;
+			break;
+		default:
+			state.delta_encoded = false;
+			break;
+		}
 	}
 
 	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats_p, ColumnWriterPageState *page_state_p,
@@ -1461,6 +1724,33 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.delta_encoded) {
+			// delta page: only the suffix that differs from the previous string is stored
+			optional_idx previous_idx;
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				auto &value = ptr[r];
+				idx_t prefix_length;
+				if (previous_idx.IsValid()) {
+					auto &previous = ptr[previous_idx.GetIndex()];
+					prefix_length = SharedPrefixLength(previous.GetData(), previous.GetSize(), value);
+				} else {
+					prefix_length = SharedPrefixLength(page_state.previous_value.c_str(),
+					                                   page_state.previous_value.size(), value);
+				}
+				page_state.prefix_lengths.push_back(NumericCast<int32_t>(prefix_length));
+				page_state.suffix_lengths.push_back(NumericCast<int32_t>(value.GetSize() - prefix_length));
+				page_state.suffixes.WriteData(const_data_ptr_cast(value.GetData() + prefix_length),
+				                              value.GetSize() - prefix_length);
+				previous_idx = r;
+			}
+			if (previous_idx.IsValid()) {
+				// the strings of the vector do not outlive this call
+				page_state.previous_value = ptr[previous_idx.GetIndex()].GetString();
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1474,13 +1764,42 @@ public:
 		}
 	}
 
+	bool SupportsBloomFilter() const override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t count) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the distinct values are inserted when the dictionary is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			state.bloom_filter->FilterInsert(
+			    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.delta_encoded);
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<StringWriterPageState>();
+		if (page_state.delta_encoded) {
+			DbpEncoder::Encode<int32_t>(temp_writer, page_state.prefix_lengths.data(),
+			                            page_state.prefix_lengths.size());
+			DbpEncoder::Encode<int32_t>(temp_writer, page_state.suffix_lengths.data(),
+			                            page_state.suffix_lengths.size());
+			temp_writer.WriteData(page_state.suffixes.GetData(), page_state.suffixes.GetPosition());
+			return;
+		}
 		if (page_state.bit_width != 0) {
 			if (!page_state.written_value) {
 				// all values are null
@@ -1494,7 +1813,10 @@ public:
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return state.delta_encoded ? Encoding::DELTA_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1527,6 +1849,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -1546,6 +1872,46 @@ public:
 	}
 
 private:
+	//! Whether the dictionary encoding is considered, i.e. whether the encoding is not forced to something else
+	bool UsesDictionaryEncoding() const {
+		auto encoding_mode = writer.GetEncodingMode();
+		return encoding_mode != ParquetEncodingMode::PLAIN && encoding_mode != ParquetEncodingMode::DELTA_BYTE_ARRAY;
+	}
+
+	static idx_t SharedPrefixLength(const char *previous, idx_t previous_size, const string_t &value) {
+		auto max_length = MinValue<idx_t>(previous_size, value.GetSize());
+		auto data = value.GetData();
+		idx_t length = 0;
+		while (length < max_length && previous[length] == data[length]) {
+			length++;
+		}
+		return length;
+	}
+
+	void AnalyzeSharedPrefixes(StringColumnWriterState &state, Vector &vector, idx_t count) {
+		auto &validity = FlatVector::Validity(vector);
+		auto strings = FlatVector::GetData<string_t>(vector);
+		optional_idx previous_idx;
+		for (idx_t i = 0; i < count; i++) {
+			if (!validity.RowIsValid(i)) {
+				continue;
+			}
+			auto &value = strings[i];
+			state.total_string_size += value.GetSize();
+			if (previous_idx.IsValid()) {
+				auto &previous = strings[previous_idx.GetIndex()];
+				state.shared_prefix_size += SharedPrefixLength(previous.GetData(), previous.GetSize(), value);
+			} else {
+				state.shared_prefix_size += SharedPrefixLength(state.last_analyzed_value.c_str(),
+				                                               state.last_analyzed_value.size(), value);
+			}
+			previous_idx = i;
+		}
+		if (previous_idx.IsValid()) {
+			state.last_analyzed_value = strings[previous_idx.GetIndex()].GetString();
+		}
+	}
+
 	bool WontUseDictionary(StringColumnWriterState &state) const {
 		return state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		       DictionaryCompressionRatio(state) < writer.DictionaryCompressionRatioThreshold();
@@ -26,6 +26,12 @@ public:
 
 public:
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns) override;
+	unique_ptr<BaseStatistics> PageStats(const ColumnIndex &column_index, idx_t page_idx) override {
+		return nullptr;
+	}
+	bool BloomFilterHash(const Value &constant, uint64_t &result) override {
+		return false;
+	}
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
 	idx_t Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
@@ -30,8 +30,10 @@ class ParquetReader;
 using duckdb_apache::thrift::protocol::TProtocol;
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
@@ -69,6 +71,11 @@ public:
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
+	//! Statistics of a single page of the current column chunk, as stored in its column index
+	virtual unique_ptr<BaseStatistics> PageStats(const ColumnIndex &column_index, idx_t page_idx);
+	//! Computes the hash of a constant as it is stored in the Bloom filter of this column.
+	//! Returns false if the constant can not be looked up in the Bloom filter.
+	virtual bool BloomFilterHash(const Value &constant, uint64_t &result);
 
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
@@ -162,14 +169,20 @@ protected:
 private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
-	void PrepareRead(parquet_filter_t &filter);
+	//! Reads the next page header and prepares the page for reading. If the page is a data page with at most
+	//! skippable_rows rows, it is skipped without decompressing it, and the number of skipped rows is returned.
+	idx_t PrepareRead(parquet_filter_t &filter, idx_t skippable_rows = 0);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	//! Skips over entire data pages using the offset index without reading them, returns the amount of rows skipped
+	idx_t SkipPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
+	//! The offset index of the current column chunk, loaded the first time we skip within the chunk
+	unique_ptr<OffsetIndex> offset_index;
 
 	duckdb_apache::thrift::protocol::TProtocol *protocol;
 	idx_t page_rows_available;
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/vector.hpp"
+#endif
+#include "thrift/TBase.h"
+
+namespace duckdb {
+
+//! The header that precedes the bitset of a Bloom filter in a Parquet file.
+//! The only algorithm (split block), hash (xxHash) and compression (uncompressed) defined by the format are supported.
+class ParquetBloomFilterHeader : public duckdb_apache::thrift::TBase {
+public:
+	//! The size of the bitset in bytes
+	int32_t num_bytes = 0;
+	//! Whether the algorithm, hash and compression fields are set to the variants we support
+	bool is_supported = false;
+
+public:
+	uint32_t read(duckdb_apache::thrift::protocol::TProtocol *iprot) override;
+	uint32_t write(duckdb_apache::thrift::protocol::TProtocol *oprot) const override;
+};
+
+//! A split block Bloom filter, as specified by the Parquet format
+class ParquetBloomFilter {
+public:
+	//! Each block consists of eight 32-bit words
+	static constexpr const idx_t BLOCK_WORDS = 8;
+	static constexpr const idx_t BLOCK_SIZE = BLOCK_WORDS * sizeof(uint32_t);
+	//! Upper bound on the size of a bitset, both for writing and for reading
+	static constexpr const idx_t MAX_BLOOM_FILTER_SIZE = 128ULL * 1024ULL * 1024ULL;
+
+public:
+	//! Creates an empty filter sized for the number of distinct values and false positive ratio
+	ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio);
+	//! Creates an empty filter with a bitset of the given size (in bytes), to be filled with ReadData
+	explicit ParquetBloomFilter(idx_t num_bytes);
+
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	data_ptr_t Data() {
+		return data_ptr_cast(words.data());
+	}
+	idx_t SizeInBytes() const {
+		return words.size() * sizeof(uint32_t);
+	}
+
+	//! Hashes the plain encoding of a value with xxHash64, as done by the Parquet format
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+private:
+	idx_t BlockCount() const {
+		return words.size() / BLOCK_WORDS;
+	}
+
+private:
+	vector<uint32_t> words;
+};
+
+} // namespace duckdb
@@ -41,6 +41,12 @@ public:
 		value_offset_ += batch_size;
 	}
 
+	template <typename T>
+	void Skip(uint32_t skip_count) {
+		buffer_.available((value_offset_ + skip_count) * sizeof(T));
+		value_offset_ += skip_count;
+	}
+
 private:
 	ByteBuffer buffer_;
 	uint32_t value_offset_;
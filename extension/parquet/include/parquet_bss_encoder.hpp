@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+/// Encoder for the Byte Stream Split encoding
+class BssEncoder {
+public:
+	/// Writes the values as sizeof(T) streams, where stream i holds byte i of every value
+	template <typename T>
+	static void Encode(WriteStream &writer, const T *values, idx_t count) {
+		auto input_bytes = const_data_ptr_cast(values);
+		auto output = unique_ptr<data_t[]>(new data_t[count * sizeof(T)]);
+		for (idx_t byte_offset = 0; byte_offset < sizeof(T); byte_offset++) {
+			auto stream = output.get() + byte_offset * count;
+			for (idx_t i = 0; i < count; i++) {
+				stream[i] = input_bytes[i * sizeof(T) + byte_offset];
+			}
+		}
+		writer.WriteData(output.get(), count * sizeof(T));
+	}
+};
+
+} // namespace duckdb
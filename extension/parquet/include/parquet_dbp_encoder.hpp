@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding
+//! Values are written in blocks of 128 values, each consisting of 4 miniblocks of 32 bit-packed deltas
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE = 128;
+	static constexpr const idx_t MINIBLOCKS_PER_BLOCK = 4;
+	static constexpr const idx_t VALUES_PER_MINIBLOCK = BLOCK_SIZE / MINIBLOCKS_PER_BLOCK;
+
+public:
+	//! Encodes count values of type T (int32_t or int64_t)
+	//! Deltas are computed with wrap-around in the width of T, so the bit width never exceeds the width of T
+	template <class T>
+	static void Encode(WriteStream &writer, const T *values, idx_t count) {
+		using UNSIGNED = typename std::make_unsigned<T>::type;
+		// header: <block size in values> <number of miniblocks in a block> <total value count> <first value>
+		VarintEncode(writer, BLOCK_SIZE);
+		VarintEncode(writer, MINIBLOCKS_PER_BLOCK);
+		VarintEncode(writer, count);
+		ZigzagVarintEncode(writer, count == 0 ? 0 : int64_t(values[0]));
+
+		UNSIGNED deltas[BLOCK_SIZE];
+		for (idx_t block_start = 1; block_start < count; block_start += BLOCK_SIZE) {
+			auto block_count = MinValue<idx_t>(BLOCK_SIZE, count - block_start);
+			// compute the deltas of the block, and the minimum delta
+			T min_delta = NumericLimits<T>::Maximum();
+			for (idx_t i = 0; i < block_count; i++) {
+				auto delta = T(UNSIGNED(values[block_start + i]) - UNSIGNED(values[block_start + i - 1]));
+				min_delta = MinValue(min_delta, delta);
+				deltas[i] = UNSIGNED(delta);
+			}
+			// the stored deltas are relative to the minimum delta, and are therefore all non-negative
+			// the last miniblock is padded with zeros
+			for (idx_t i = 0; i < BLOCK_SIZE; i++) {
+				deltas[i] = i < block_count ? UNSIGNED(deltas[i] - UNSIGNED(min_delta)) : 0;
+			}
+			ZigzagVarintEncode(writer, int64_t(min_delta));
+
+			// the bit widths of the miniblocks, miniblocks without any values are not written
+			uint8_t bit_widths[MINIBLOCKS_PER_BLOCK];
+			for (idx_t miniblock_idx = 0; miniblock_idx < MINIBLOCKS_PER_BLOCK; miniblock_idx++) {
+				UNSIGNED max_delta = 0;
+				for (idx_t i = 0; i < VALUES_PER_MINIBLOCK; i++) {
+					max_delta = MaxValue(max_delta, deltas[miniblock_idx * VALUES_PER_MINIBLOCK + i]);
+				}
+				bit_widths[miniblock_idx] = BitWidth(max_delta);
+				writer.Write<uint8_t>(bit_widths[miniblock_idx]);
+			}
+			for (idx_t miniblock_idx = 0; miniblock_idx * VALUES_PER_MINIBLOCK < block_count; miniblock_idx++) {
+				BitPack(writer, deltas + miniblock_idx * VALUES_PER_MINIBLOCK, VALUES_PER_MINIBLOCK,
+				        bit_widths[miniblock_idx]);
+			}
+		}
+	}
+
+	//! The number of bits required to store the value
+	static uint8_t BitWidth(uint64_t value) {
+		uint8_t result = 0;
+		while (value) {
+			result++;
+			value >>= 1;
+		}
+		return result;
+	}
+
+private:
+	static void VarintEncode(WriteStream &writer, uint64_t value) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+
+	static void ZigzagVarintEncode(WriteStream &writer, int64_t value) {
+		VarintEncode(writer, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+	}
+
+	//! Bit-packs the values least significant bit first, the count must be a multiple of 8
+	template <class UNSIGNED>
+	static void BitPack(WriteStream &writer, const UNSIGNED *values, idx_t count, uint8_t bit_width) {
+		D_ASSERT(count % 8 == 0);
+		uint8_t current_byte = 0;
+		idx_t bit_pos = 0;
+		for (idx_t i = 0; i < count; i++) {
+			uint64_t value = values[i];
+			idx_t remaining_bits = bit_width;
+			while (remaining_bits > 0) {
+				auto bits = MinValue<idx_t>(8 - bit_pos, remaining_bits);
+				current_byte |= uint8_t((value & ((1ULL << bits) - 1)) << bit_pos);
+				value >>= bits;
+				remaining_bits -= bits;
+				bit_pos += bits;
+				if (bit_pos == 8) {
+					writer.Write<uint8_t>(current_byte);
+					current_byte = 0;
+					bit_pos = 0;
+				}
+			}
+		}
+		D_ASSERT(bit_pos == 0);
+	}
+};
+
+} // namespace duckdb
@@ -23,6 +23,7 @@ public:
 	ParquetFileMetadataCache(unique_ptr<duckdb_parquet::format::FileMetaData> file_metadata, time_t r_time,
 	                         unique_ptr<GeoParquetFileMetadata> geo_metadata)
 	    : metadata(std::move(file_metadata)), read_time(r_time), geo_metadata(std::move(geo_metadata)) {
+		estimated_memory = EstimateMemory(*metadata);
 	}
 
 	~ParquetFileMetadataCache() override = default;
@@ -36,6 +37,9 @@ public:
 	//! GeoParquet metadata
 	unique_ptr<GeoParquetFileMetadata> geo_metadata;
 
+	//! The estimated memory used by the metadata
+	idx_t estimated_memory = 0;
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -44,5 +48,39 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	optional_idx GetEstimatedCacheMemory() const override {
+		return estimated_memory;
+	}
+
+	//! Whether the metadata was read less than ttl seconds ago, and can be used without checking the file
+	bool IsFresh(time_t ttl) const {
+		return ttl > 0 && time(nullptr) < read_time + ttl;
+	}
+
+private:
+	static idx_t EstimateMemory(const duckdb_parquet::format::FileMetaData &file_metadata) {
+		auto statistics_size = [](const duckdb_parquet::format::Statistics &stats) {
+			return stats.min.size() + stats.max.size() + stats.min_value.size() + stats.max_value.size();
+		};
+		idx_t result = sizeof(duckdb_parquet::format::FileMetaData) + sizeof(ParquetFileMetadataCache);
+		for (auto &schema_element : file_metadata.schema) {
+			result += sizeof(schema_element) + schema_element.name.size();
+		}
+		for (auto &key_value : file_metadata.key_value_metadata) {
+			result += sizeof(key_value) + key_value.key.size() + key_value.value.size();
+		}
+		for (auto &row_group : file_metadata.row_groups) {
+			result += sizeof(row_group);
+			for (auto &column : row_group.columns) {
+				result += sizeof(column) + statistics_size(column.meta_data.statistics);
+				result += column.meta_data.encodings.size() * sizeof(duckdb_parquet::format::Encoding::type);
+				for (auto &path : column.meta_data.path_in_schema) {
+					result += sizeof(path) + path.size();
+				}
+			}
+		}
+		return result;
+	}
 };
 } // namespace duckdb
@@ -46,6 +46,8 @@ class ParquetEncryptionConfig;
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// Number of prefetched ranges of remote files that are read concurrently
+	static constexpr idx_t DEFAULT_CONCURRENT_READS = 8;
 };
 
 struct ParquetReaderScanState {
@@ -64,6 +66,10 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Sorted, non-overlapping row ranges [start, end) of the current row group that the page index proved can not
+	//! satisfy the filters
+	vector<pair<idx_t, idx_t>> pruned_row_ranges;
 };
 
 struct ParquetColumnDefinition {
@@ -191,6 +197,8 @@ public:
 
 	static unique_ptr<BaseStatistics> ReadStatistics(ClientContext &context, ParquetOptions parquet_options,
 	                                                 shared_ptr<ParquetFileMetadataCache> metadata, const string &name);
+	//! The number of seconds for which cached metadata is used without checking the file (0: check on every use)
+	static time_t GetMetadataCacheTTL(ClientContext &context);
 
 private:
 	//! Construct a parquet reader but **do not** open a file, used in ReadStatistics only
@@ -209,6 +217,10 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the column index of a column chunk to find pages whose rows can not satisfy the filter
+	void PrunePages(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter);
+	//! Uses the Bloom filter of a column chunk to check whether equality filters can not match any row in it
+	bool BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader, const TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -61,6 +61,31 @@ public:
 		}
 	}
 
+	//! Skips over values without unpacking them
+	void Skip(uint32_t skip_count) {
+		while (skip_count > 0) {
+			if (repeat_count_ > 0) {
+				auto repeat_batch = MinValue(skip_count, repeat_count_);
+				repeat_count_ -= repeat_batch;
+				skip_count -= repeat_batch;
+			} else if (literal_count_ > 0) {
+				auto literal_batch = MinValue(skip_count, literal_count_);
+				// advance the bit position in the same way BitUnpack does
+				auto bit_pos = static_cast<uint64_t>(bitpack_pos) + static_cast<uint64_t>(literal_batch) * bit_width_;
+				if (bit_pos > ParquetDecodeUtils::BITPACK_DLEN) {
+					auto byte_count = (bit_pos - 1) / ParquetDecodeUtils::BITPACK_DLEN;
+					buffer_.inc(byte_count);
+					bit_pos -= byte_count * ParquetDecodeUtils::BITPACK_DLEN;
+				}
+				bitpack_pos = static_cast<uint8_t>(bit_pos);
+				literal_count_ -= literal_batch;
+				skip_count -= literal_batch;
+			} else if (!NextCounts<uint32_t>()) {
+				throw std::runtime_error("RLE decode did not find enough values");
+			}
+		}
+	}
+
 	static uint8_t ComputeBitWidth(idx_t val) {
 		if (val == 0) {
 			return 0;
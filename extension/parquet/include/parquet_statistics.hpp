@@ -9,6 +9,7 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::SchemaElement;
 
 struct LogicalType;
@@ -19,8 +20,16 @@ struct ParquetStatisticsUtils {
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
 
+	//! Transforms the min/max of a single page, as stored in the column index of a column chunk
+	static unique_ptr<BaseStatistics> TransformPageStatistics(const ColumnReader &reader,
+	                                                          const ColumnIndex &column_index, idx_t page_idx);
+
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
+
+private:
+	static unique_ptr<BaseStatistics> TransformLeafStatistics(const ColumnReader &reader,
+	                                                          const duckdb_parquet::format::Statistics &parquet_stats);
 };
 
 } // namespace duckdb
@@ -38,6 +38,19 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! How the writer chooses the encodings of the data pages of a column chunk
+enum class ParquetEncodingMode : uint8_t {
+	//! PLAIN, or RLE_DICTIONARY for strings with a beneficial dictionary
+	DEFAULT = 0,
+	//! Choose the encoding per column chunk, based on the type and the data
+	AUTO = 1,
+	//! Force an encoding for all columns with a type that supports it, other columns use the default
+	PLAIN = 2,
+	DELTA_BINARY_PACKED = 3,
+	DELTA_BYTE_ARRAY = 4,
+	BYTE_STREAM_SPLIT = 5
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -67,12 +80,14 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, const vector<string> &bloom_filter_columns,
+	              double bloom_filter_false_positive_ratio, ParquetEncodingMode encoding_mode, bool debug_use_openssl);
 
 public:
-	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Encodes and compresses the column chunks of a row group, in parallel if multiple threads are available
+	void PrepareRowGroup(ClientContext &context, ColumnDataCollection &buffer, PreparedRowGroup &result);
 	void FlushRowGroup(PreparedRowGroup &row_group);
-	void Flush(ColumnDataCollection &buffer);
+	void Flush(ClientContext &context, ColumnDataCollection &buffer);
 	void Finalize();
 
 	static duckdb_parquet::format::Type::type DuckDBTypeToParquetType(const LogicalType &duckdb_type);
@@ -103,6 +118,16 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether a Bloom filter is written for the (top-level) column with the given name
+	bool HasBloomFilter(const string &column_name) const {
+		return bloom_filter_columns.find(column_name) != bloom_filter_columns.end();
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
+	ParquetEncodingMode GetEncodingMode() const {
+		return encoding_mode;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -125,6 +150,9 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
+	ParquetEncodingMode encoding_mode;
 	bool debug_use_openssl;
 	shared_ptr<EncryptionUtil> encryption_util;
 
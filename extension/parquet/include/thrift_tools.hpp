@@ -7,6 +7,10 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #endif
 
 namespace duckdb {
@@ -31,16 +35,22 @@ struct ReadHead {
 	}
 };
 
-// Comparator for ReadHeads that are either overlapping, adjacent, or within ALLOW_GAP bytes from each other
+// Comparator for ReadHeads that are either overlapping, adjacent, or within allow_gap bytes from each other
 struct ReadHeadComparator {
 	static constexpr uint64_t ALLOW_GAP = 1 << 14; // 16 KiB
+
+	explicit ReadHeadComparator(uint64_t allow_gap = ALLOW_GAP) : allow_gap(allow_gap) {
+	}
+
+	uint64_t allow_gap;
+
 	bool operator()(const ReadHead *a, const ReadHead *b) const {
 		auto a_start = a->location;
 		auto a_end = a->location + a->size;
 		auto b_start = b->location;
 
-		if (a_end <= NumericLimits<idx_t>::Maximum() - ALLOW_GAP) {
-			a_end += ALLOW_GAP;
+		if (a_end <= NumericLimits<idx_t>::Maximum() - allow_gap) {
+			a_end += allow_gap;
 		}
 
 		return a_start < b_start && a_end < b_start;
@@ -103,8 +113,19 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
+	// Set the maximum gap between merged ranges, and the number of ranges that are read concurrently by tasks of the
+	// scheduler
+	void SetOptions(uint64_t merge_gap, idx_t max_concurrent_reads_p, TaskScheduler &scheduler_p) {
+		D_ASSERT(merge_set.empty());
+		merge_set = std::set<ReadHead *, ReadHeadComparator>(ReadHeadComparator(merge_gap));
+		max_concurrent_reads = MaxValue<idx_t>(max_concurrent_reads_p, 1);
+		scheduler = &scheduler_p;
+	}
+
 	// Prefetch all read heads
 	void Prefetch() {
+		// large read heads are split into parts, so that they are also read concurrently
+		vector<ReadPart> parts;
 		for (auto &read_head : read_heads) {
 			read_head.Allocate(allocator);
 
@@ -112,10 +133,70 @@ struct ReadAheadBuffer {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
+			auto part_size = max_concurrent_reads > 1 ? CONCURRENT_READ_PART_SIZE : read_head.size;
+			for (idx_t offset = 0; offset < read_head.size; offset += part_size) {
+				parts.push_back(ReadPart {&read_head, offset, MinValue<idx_t>(part_size, read_head.size - offset)});
+			}
+		}
+
+		auto task_count = MinValue<idx_t>(max_concurrent_reads, parts.size());
+		if (task_count <= 1 || !scheduler) {
+			for (auto &part : parts) {
+				ReadRange(part);
+			}
+		} else {
+			// the parts are read by tasks of the scheduler, so that the requests to (remote) files are in flight
+			// concurrently - the current thread works on the tasks as well
+			TaskExecutor executor(*scheduler);
+			atomic<idx_t> next_part(0);
+			for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+				executor.ScheduleTask(make_uniq<ReadPartsTask>(executor, *this, parts, next_part));
+			}
+			executor.WorkOnTasks();
+		}
+		for (auto &read_head : read_heads) {
 			read_head.data_isset = true;
 		}
 	}
+
+private:
+	// Ranges larger than this are split into parts when reading concurrently
+	static constexpr idx_t CONCURRENT_READ_PART_SIZE = 1 << 23; // 8 MiB
+
+	struct ReadPart {
+		ReadHead *read_head;
+		idx_t offset;
+		idx_t size;
+	};
+
+	void ReadRange(const ReadPart &part) {
+		handle.Read(part.read_head->data.get() + part.offset, part.size, part.read_head->location + part.offset);
+	}
+
+	// Reads parts until all parts have been claimed by the tasks
+	class ReadPartsTask : public BaseExecutorTask {
+	public:
+		ReadPartsTask(TaskExecutor &executor, ReadAheadBuffer &buffer, const vector<ReadPart> &parts,
+		              atomic<idx_t> &next_part)
+		    : BaseExecutorTask(executor), buffer(buffer), parts(parts), next_part(next_part) {
+		}
+
+		void ExecuteTask() override {
+			for (auto part_idx = next_part++; part_idx < parts.size(); part_idx = next_part++) {
+				buffer.ReadRange(parts[part_idx]);
+			}
+		}
+
+	private:
+		ReadAheadBuffer &buffer;
+		const vector<ReadPart> &parts;
+		atomic<idx_t> &next_part;
+	};
+
+	// The number of ranges that are read concurrently
+	idx_t max_concurrent_reads = 1;
+	// The scheduler that runs the tasks that read ranges concurrently
+	optional_ptr<TaskScheduler> scheduler;
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
@@ -164,6 +245,11 @@ public:
 		ra_buffer.AddReadHead(pos, len, can_merge);
 	}
 
+	// Set the maximum gap between merged ranges, and the number of ranges that are read concurrently
+	void SetPrefetchOptions(uint64_t merge_gap, idx_t max_concurrent_reads, TaskScheduler &scheduler) {
+		ra_buffer.SetOptions(merge_gap, max_concurrent_reads, scheduler);
+	}
+
 	// Prevents any further merges, should be called before PrefetchRegistered
 	void FinalizeRegistration() {
 		ra_buffer.merge_set.clear();
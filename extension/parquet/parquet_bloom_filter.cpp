@@ -0,0 +1,148 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "thrift/protocol/TProtocol.h"
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+
+//===--------------------------------------------------------------------===//
+// Bloom Filter Header
+//===--------------------------------------------------------------------===//
+// Reads a union of empty structs, returns true if the variant with field id 1 is set
+static uint32_t ReadUnionVariant(TProtocol &iprot, bool &is_first_variant) {
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	is_first_variant = false;
+	xfer += iprot.readStructBegin(fname);
+	while (true) {
+		xfer += iprot.readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			is_first_variant = true;
+		}
+		xfer += iprot.skip(ftype);
+		xfer += iprot.readFieldEnd();
+	}
+	xfer += iprot.readStructEnd();
+	return xfer;
+}
+
+static uint32_t WriteUnionVariant(TProtocol &oprot, const char *name, int16_t fid, const char *variant) {
+	uint32_t xfer = 0;
+	xfer += oprot.writeFieldBegin(name, duckdb_apache::thrift::protocol::T_STRUCT, fid);
+	xfer += oprot.writeStructBegin(name);
+	xfer += oprot.writeFieldBegin(variant, duckdb_apache::thrift::protocol::T_STRUCT, 1);
+	xfer += oprot.writeStructBegin(variant);
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::read(TProtocol *iprot) {
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	bool has_num_bytes = false;
+	bool split_block = false;
+	bool xxhash = false;
+	bool uncompressed = false;
+
+	xfer += iprot->readStructBegin(fname);
+	while (true) {
+		xfer += iprot->readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_I32) {
+			xfer += iprot->readI32(num_bytes);
+			has_num_bytes = true;
+		} else if (fid == 2 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnionVariant(*iprot, split_block);
+		} else if (fid == 3 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnionVariant(*iprot, xxhash);
+		} else if (fid == 4 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnionVariant(*iprot, uncompressed);
+		} else {
+			xfer += iprot->skip(ftype);
+		}
+		xfer += iprot->readFieldEnd();
+	}
+	xfer += iprot->readStructEnd();
+	is_supported = has_num_bytes && split_block && xxhash && uncompressed;
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::write(TProtocol *oprot) const {
+	uint32_t xfer = 0;
+	xfer += oprot->writeStructBegin("BloomFilterHeader");
+	xfer += oprot->writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	xfer += oprot->writeI32(num_bytes);
+	xfer += oprot->writeFieldEnd();
+	xfer += WriteUnionVariant(*oprot, "algorithm", 2, "BLOCK");
+	xfer += WriteUnionVariant(*oprot, "hash", 3, "XXHASH");
+	xfer += WriteUnionVariant(*oprot, "compression", 4, "UNCOMPRESSED");
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	return xfer;
+}
+
+//===--------------------------------------------------------------------===//
+// Split Block Bloom Filter
+//===--------------------------------------------------------------------===//
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::BLOCK_WORDS] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio) {
+	// the optimal number of bits for eight hash functions (see the Parquet specification)
+	auto num_bits = -8.0 * static_cast<double>(MaxValue<idx_t>(num_distinct_values, 1)) /
+	                std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	auto num_bytes = MinValue<idx_t>(static_cast<idx_t>(num_bits / 8.0) + 1, MAX_BLOOM_FILTER_SIZE);
+	num_bytes = MaxValue<idx_t>(NextPowerOfTwo(num_bytes), BLOCK_SIZE);
+	words.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes) {
+	D_ASSERT(num_bytes % BLOCK_SIZE == 0);
+	words.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block_idx = ((hash >> 32) * BlockCount()) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = words.data() + block_idx * BLOCK_WORDS;
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block_idx = ((hash >> 32) * BlockCount()) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = words.data() + block_idx * BLOCK_WORDS;
+	for (idx_t i = 0; i < BLOCK_WORDS; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+} // namespace duckdb
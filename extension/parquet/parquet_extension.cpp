@@ -25,6 +25,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -201,6 +202,14 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The columns for which a Bloom filter is written
+	vector<string> bloom_filter_columns;
+	//! The target false positive ratio of the Bloom filters
+	double bloom_filter_false_positive_ratio = 0.01;
+
+	//! How the encodings of the column chunks are chosen
+	ParquetEncodingMode encoding_mode = ParquetEncodingMode::DEFAULT;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -479,6 +488,7 @@ public:
 			// for more than one file, we could be lucky and metadata for *every* file is in the object cache (if
 			// enabled at all)
 			FileSystem &fs = FileSystem::GetFileSystem(context);
+			auto ttl = ParquetReader::GetMetadataCacheTTL(context);
 
 			for (const auto &file_name : bind_data.file_list->Files()) {
 				auto metadata = cache.Get<ParquetFileMetadataCache>(file_name);
@@ -486,7 +496,9 @@ public:
 					// missing metadata entry in cache, no usable stats
 					return nullptr;
 				}
-				if (!fs.IsRemoteFile(file_name)) {
+				if (metadata->IsFresh(ttl)) {
+					// the metadata was read within the TTL, we use it without touching the (possibly remote) file
+				} else if (!fs.IsRemoteFile(file_name)) {
 					auto handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 					// we need to check if the metadata cache entries are current
 					if (fs.GetLastModifiedTime(*handle) >= metadata->read_time) {
@@ -1183,6 +1195,16 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			auto column_names = names;
+			auto selected = ParseColumnList(ConvertVectorToValue(option.second), column_names, loption);
+			for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+				if (selected[col_idx]) {
+					bind_data->bloom_filter_columns.push_back(names[col_idx]);
+				}
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -1276,10 +1298,36 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (val <= 0 || val >= 1) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
+		} else if (loption == "encoding") {
+			const auto roption = StringUtil::Lower(option.second[0].ToString());
+			if (roption == "auto") {
+				bind_data->encoding_mode = ParquetEncodingMode::AUTO;
+			} else if (roption == "plain") {
+				bind_data->encoding_mode = ParquetEncodingMode::PLAIN;
+			} else if (roption == "delta_binary_packed") {
+				bind_data->encoding_mode = ParquetEncodingMode::DELTA_BINARY_PACKED;
+			} else if (roption == "delta_byte_array") {
+				bind_data->encoding_mode = ParquetEncodingMode::DELTA_BYTE_ARRAY;
+			} else if (roption == "byte_stream_split") {
+				bind_data->encoding_mode = ParquetEncodingMode::BYTE_STREAM_SPLIT;
+			} else {
+				throw BinderException("Expected %s argument to be either [auto, plain, delta_binary_packed, "
+				                      "delta_byte_array, or byte_stream_split]",
+				                      loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (!bind_data->bloom_filter_columns.empty() && bind_data->encryption_config) {
+		throw BinderException("BLOOM_FILTER_COLUMNS is not supported when writing encrypted Parquet files");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1305,7 +1353,9 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.bloom_filter_columns,
+	                             parquet_bind.bloom_filter_false_positive_ratio, parquet_bind.encoding_mode,
+	                             parquet_bind.debug_use_openssl);
 	return std::move(global_state);
 }
 
@@ -1322,7 +1372,7 @@ void ParquetWriteSink(ExecutionContext &context, FunctionData &bind_data_p, Glob
 	    local_state.buffer.SizeInBytes() >= bind_data.row_group_size_bytes) {
 		// if the chunk collection exceeds a certain size (rows/bytes) we flush it to the parquet file
 		local_state.append_state.current_chunk_state.handles.clear();
-		global_state.writer->Flush(local_state.buffer);
+		global_state.writer->Flush(context.client, local_state.buffer);
 		local_state.buffer.InitializeAppend(local_state.append_state);
 	}
 }
@@ -1332,7 +1382,7 @@ void ParquetWriteCombine(ExecutionContext &context, FunctionData &bind_data, Glo
 	auto &global_state = gstate.Cast<ParquetWriteGlobalState>();
 	auto &local_state = lstate.Cast<ParquetWriteLocalState>();
 	// flush any data left in the local state to the file
-	global_state.writer->Flush(local_state.buffer);
+	global_state.writer->Flush(context.client, local_state.buffer);
 }
 
 void ParquetWriteFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate) {
@@ -1412,6 +1462,49 @@ EnumUtil::FromString<duckdb_parquet::format::CompressionCodec::type>(const char
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template <>
+const char *EnumUtil::ToChars<ParquetEncodingMode>(ParquetEncodingMode value) {
+	switch (value) {
+	case ParquetEncodingMode::DEFAULT:
+		return "DEFAULT";
+	case ParquetEncodingMode::AUTO:
+		return "AUTO";
+	case ParquetEncodingMode::PLAIN:
+		return "PLAIN";
+	case ParquetEncodingMode::DELTA_BINARY_PACKED:
+		return "DELTA_BINARY_PACKED";
+	case ParquetEncodingMode::DELTA_BYTE_ARRAY:
+		return "DELTA_BYTE_ARRAY";
+	case ParquetEncodingMode::BYTE_STREAM_SPLIT:
+		return "BYTE_STREAM_SPLIT";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", uint8_t(value)));
+	}
+}
+
+template <>
+ParquetEncodingMode EnumUtil::FromString<ParquetEncodingMode>(const char *value) {
+	if (StringUtil::Equals(value, "DEFAULT")) {
+		return ParquetEncodingMode::DEFAULT;
+	}
+	if (StringUtil::Equals(value, "AUTO")) {
+		return ParquetEncodingMode::AUTO;
+	}
+	if (StringUtil::Equals(value, "PLAIN")) {
+		return ParquetEncodingMode::PLAIN;
+	}
+	if (StringUtil::Equals(value, "DELTA_BINARY_PACKED")) {
+		return ParquetEncodingMode::DELTA_BINARY_PACKED;
+	}
+	if (StringUtil::Equals(value, "DELTA_BYTE_ARRAY")) {
+		return ParquetEncodingMode::DELTA_BYTE_ARRAY;
+	}
+	if (StringUtil::Equals(value, "BYTE_STREAM_SPLIT")) {
+		return ParquetEncodingMode::BYTE_STREAM_SPLIT;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bind_data_p,
                                  const CopyFunction &function) {
 	auto &bind_data = bind_data_p.Cast<ParquetWriteBindData>();
@@ -1429,6 +1522,11 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault<vector<string>>(112, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<double>(113, "bloom_filter_false_positive_ratio",
+	                                            bind_data.bloom_filter_false_positive_ratio, 0.01);
+	serializer.WritePropertyWithDefault<ParquetEncodingMode>(114, "encoding_mode", bind_data.encoding_mode,
+	                                                         ParquetEncodingMode::DEFAULT);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1448,6 +1546,11 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithExplicitDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithExplicitDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<vector<string>>(112, "bloom_filter_columns", data->bloom_filter_columns);
+	data->bloom_filter_false_positive_ratio =
+	    deserializer.ReadPropertyWithExplicitDefault<double>(113, "bloom_filter_false_positive_ratio", 0.01);
+	data->encoding_mode = deserializer.ReadPropertyWithExplicitDefault<ParquetEncodingMode>(
+	    114, "encoding_mode", ParquetEncodingMode::DEFAULT);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1476,7 +1579,7 @@ unique_ptr<PreparedBatchData> ParquetWritePrepareBatch(ClientContext &context, F
                                                        unique_ptr<ColumnDataCollection> collection) {
 	auto &global_state = gstate.Cast<ParquetWriteGlobalState>();
 	auto result = make_uniq<ParquetWriteBatchData>();
-	global_state.writer->PrepareRowGroup(*collection, result->prepared_row_group);
+	global_state.writer->PrepareRowGroup(context, *collection, result->prepared_row_group);
 	return std::move(result);
 }
 
@@ -1680,6 +1783,21 @@ void ParquetExtension::Load(DuckDB &db) {
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("parquet_prefetch_merge_gap",
+	                          "Ranges of remote Parquet files that are at most this many bytes apart are read with a "
+	                          "single request",
+	                          LogicalType::UBIGINT, Value::UBIGINT(ReadHeadComparator::ALLOW_GAP));
+	config.AddExtensionOption("parquet_prefetch_concurrent_reads",
+	                          "The number of ranges of a remote Parquet file that are read concurrently",
+	                          LogicalType::UBIGINT,
+	                          Value::UBIGINT(ParquetReaderPrefetchConfig::DEFAULT_CONCURRENT_READS));
+	config.AddExtensionOption("prefetch_all_parquet_files",
+	                          "Use the prefetching of remote Parquet files for all Parquet files, including local files",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("parquet_metadata_cache_ttl",
+	                          "The number of seconds for which cached Parquet metadata is used without checking the last "
+	                          "modification time of the file (0: check on every use)",
+	                          LogicalType::BIGINT, Value::BIGINT(0));
 }
 
 std::string ParquetExtension::Name() {
@@ -8,6 +8,7 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -546,12 +547,14 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 			metadata =
 			    LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config, *encryption_util);
 		} else {
-			auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
-			metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
-			if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
+			auto &cache = ObjectCache::GetObjectCache(context_p);
+			metadata = cache.Get<ParquetFileMetadataCache>(file_name);
+			// metadata that was read within the TTL is used without checking the last modification time
+			if (!metadata || (!metadata->IsFresh(GetMetadataCacheTTL(context_p)) &&
+			                  fs.GetLastModifiedTime(*file_handle) + 10 >= metadata->read_time)) {
 				metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
 				                        *encryption_util);
-				ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
+				cache.Put(file_name, metadata);
 			}
 		}
 	} else {
@@ -563,6 +566,14 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 ParquetUnionData::~ParquetUnionData() {
 }
 
+time_t ParquetReader::GetMetadataCacheTTL(ClientContext &context) {
+	Value ttl_val;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_ttl", ttl_val) && !ttl_val.IsNull()) {
+		return NumericCast<time_t>(ttl_val.GetValue<int64_t>());
+	}
+	return 0;
+}
+
 ParquetReader::ParquetReader(ClientContext &context_p, ParquetOptions parquet_options_p,
                              shared_ptr<ParquetFileMetadataCache> metadata_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
@@ -763,12 +774,15 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+				skip_chunk = BloomFilterExcludes(state, *column_reader, filter);
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
 				return;
 			}
+			PrunePages(state, *column_reader, filter);
 		}
 	}
 
@@ -794,9 +808,18 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	if (!state.file_handle || state.file_handle->path != file_handle->path) {
 		auto flags = FileFlags::FILE_FLAGS_READ;
 
+		bool prefetch_all_files = false;
+		Value prefetch_all;
+		if (context.TryGetCurrentSetting("prefetch_all_parquet_files", prefetch_all) && !prefetch_all.IsNull()) {
+			prefetch_all_files = BooleanValue::Get(prefetch_all);
+		}
 		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
 			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+			// the prefetched ranges are read concurrently
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO | FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
+		} else if (prefetch_all_files && file_handle->CanSeek()) {
+			// local files are read with positional reads, which can be issued concurrently
+			state.prefetch_mode = true;
 		} else {
 			state.prefetch_mode = false;
 		}
@@ -805,6 +828,19 @@ void ParquetReader::InitializeScan(ClientContext &context, ParquetReaderScanStat
 	}
 
 	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	if (state.prefetch_mode) {
+		uint64_t merge_gap = ReadHeadComparator::ALLOW_GAP;
+		idx_t concurrent_reads = ParquetReaderPrefetchConfig::DEFAULT_CONCURRENT_READS;
+		Value val;
+		if (context.TryGetCurrentSetting("parquet_prefetch_merge_gap", val) && !val.IsNull()) {
+			merge_gap = val.GetValue<uint64_t>();
+		}
+		if (context.TryGetCurrentSetting("parquet_prefetch_concurrent_reads", val) && !val.IsNull()) {
+			concurrent_reads = val.GetValue<uint64_t>();
+		}
+		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		trans.SetPrefetchOptions(merge_gap, concurrent_reads, TaskScheduler::GetScheduler(context));
+	}
 	state.root_reader = CreateReader(context);
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -1009,6 +1045,103 @@ void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
 	}
 }
 
+static bool BloomFilterExcludesRecursive(const ParquetBloomFilter &bloom_filter, ColumnReader &column_reader,
+                                         const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !column_reader.BloomFilterHash(constant_filter.constant, hash)) {
+			return false;
+		}
+		return !bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// an IN list is pushed down as a disjunction of equality filters - all of them must miss
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludesRecursive(bloom_filter, column_reader, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludesRecursive(bloom_filter, column_reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	if (parquet_options.encryption_config || column_reader.Type().IsNested()) {
+		return false;
+	}
+	auto &group = GetGroup(state);
+	if (column_reader.FileIdx() >= group.columns.size()) {
+		return false;
+	}
+	auto &meta_data = group.columns[column_reader.FileIdx()].meta_data;
+	if (!meta_data.__isset.bloom_filter_offset) {
+		return false;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(UnsafeNumericCast<idx_t>(meta_data.bloom_filter_offset));
+	ParquetBloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!header.is_supported || header.num_bytes <= 0 ||
+	    NumericCast<idx_t>(header.num_bytes) % ParquetBloomFilter::BLOCK_SIZE != 0 ||
+	    NumericCast<idx_t>(header.num_bytes) > ParquetBloomFilter::MAX_BLOOM_FILTER_SIZE) {
+		// we can not interpret this Bloom filter
+		return false;
+	}
+	ParquetBloomFilter bloom_filter(NumericCast<idx_t>(header.num_bytes));
+	trans.read(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+	return BloomFilterExcludesRecursive(bloom_filter, column_reader, filter);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state, ColumnReader &column_reader, TableFilter &filter) {
+	if (parquet_options.encryption_config || column_reader.Type().IsNested()) {
+		return;
+	}
+	auto &group = GetGroup(state);
+	if (column_reader.FileIdx() >= group.columns.size()) {
+		return;
+	}
+	auto &chunk = group.columns[column_reader.FileIdx()];
+	if (!chunk.__isset.column_index_offset || !chunk.__isset.offset_index_offset) {
+		// no page index
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	ColumnIndex column_index;
+	trans.SetLocation(UnsafeNumericCast<idx_t>(chunk.column_index_offset));
+	Read(column_index, *state.thrift_file_proto);
+	OffsetIndex offset_index;
+	trans.SetLocation(UnsafeNumericCast<idx_t>(chunk.offset_index_offset));
+	Read(offset_index, *state.thrift_file_proto);
+
+	auto &page_locations = offset_index.page_locations;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto page_stats = column_reader.PageStats(column_index, page_idx);
+		if (!page_stats || filter.CheckStatistics(*page_stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			continue;
+		}
+		auto start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto end = page_idx + 1 < page_locations.size() ? page_locations[page_idx + 1].first_row_index : group.num_rows;
+		state.pruned_row_ranges.emplace_back(start, NumericCast<idx_t>(end));
+	}
+}
+
 bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &result) {
 	if (state.finished) {
 		return false;
@@ -1022,6 +1155,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
 		trans.ClearPrefetch();
 		state.current_group_prefetched = false;
+		state.pruned_row_ranges.clear();
 
 		if ((idx_t)state.current_group == state.group_idx_list.size()) {
 			state.finished = true;
@@ -1038,8 +1172,24 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
 
+		// merge the pruned page ranges of the different filter columns
+		auto &ranges = state.pruned_row_ranges;
+		if (!ranges.empty()) {
+			std::sort(ranges.begin(), ranges.end());
+			idx_t merged_count = 0;
+			for (idx_t i = 1; i < ranges.size(); i++) {
+				if (ranges[i].first <= ranges[merged_count].second) {
+					ranges[merged_count].second = MaxValue(ranges[merged_count].second, ranges[i].second);
+				} else {
+					ranges[++merged_count] = ranges[i];
+				}
+			}
+			ranges.resize(merged_count + 1);
+		}
+
 		auto &group = GetGroup(state);
-		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
+		// if pages were pruned we don't prefetch the column chunks, so that only the surviving pages are read
+		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows && ranges.empty()) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
 
@@ -1096,6 +1246,25 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return false; // end of last group, we are done
 	}
 
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// skip over the rows of pages that were pruned using the page index
+	auto pruned_end = state.group_offset;
+	for (auto &range : state.pruned_row_ranges) {
+		if (range.first <= pruned_end && range.second > pruned_end) {
+			pruned_end = range.second;
+		}
+	}
+	if (pruned_end > state.group_offset) {
+		auto skip_count = MinValue<idx_t>(pruned_end, GetGroup(state).num_rows) - state.group_offset;
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+		}
+		state.group_offset += skip_count;
+		result.SetCardinality(0);
+		return true;
+	}
+
 	// we evaluate simple table filters directly in this scan so we can skip decoding column data that's never going to
 	// be relevant
 	parquet_filter_t filter_mask;
@@ -1105,6 +1274,14 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	for (idx_t i = this_output_chunk_rows; i < STANDARD_VECTOR_SIZE; i++) {
 		filter_mask.set(i, false);
 	}
+	// mask out rows of pruned pages
+	for (auto &range : state.pruned_row_ranges) {
+		auto start = MaxValue<idx_t>(range.first, state.group_offset);
+		auto end = MinValue<idx_t>(range.second, state.group_offset + this_output_chunk_rows);
+		for (idx_t i = start; i < end; i++) {
+			filter_mask.set(i - state.group_offset, false);
+		}
+	}
 
 	state.define_buf.zero();
 	state.repeat_buf.zero();
@@ -1112,8 +1289,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
@@ -320,7 +320,32 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformLeafStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformPageStatistics(const ColumnReader &reader,
+                                                                           const ColumnIndex &column_index,
+                                                                           idx_t page_idx) {
+	if (page_idx >= column_index.min_values.size() || page_idx >= column_index.max_values.size()) {
+		return nullptr;
+	}
+	if (page_idx < column_index.null_pages.size() && column_index.null_pages[page_idx]) {
+		// the min/max of pages that only contain NULL values are not set
+		return nullptr;
+	}
+	duckdb_parquet::format::Statistics page_stats;
+	page_stats.__set_min_value(column_index.min_values[page_idx]);
+	page_stats.__set_max_value(column_index.max_values[page_idx]);
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		page_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	return TransformLeafStatistics(reader, page_stats);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformLeafStatistics(const ColumnReader &reader,
+                                                const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> row_group_stats;
 
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
@@ -15,6 +15,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #endif
@@ -319,10 +321,14 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
                              double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
+                             const vector<string> &bloom_filter_columns_p,
+                             double bloom_filter_false_positive_ratio_p, ParquetEncodingMode encoding_mode_p,
                              bool debug_use_openssl_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
       dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      bloom_filter_columns(bloom_filter_columns_p.begin(), bloom_filter_columns_p.end()),
+      bloom_filter_false_positive_ratio(bloom_filter_false_positive_ratio_p), encoding_mode(encoding_mode_p),
       debug_use_openssl(debug_use_openssl_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
@@ -392,9 +398,74 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 	}
 }
 
-void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
+//! Analyzes, prepares and encodes a set of columns of a row group
+static void PrepareColumns(ColumnDataCollection &buffer, const vector<column_t> &column_ids,
+                           const vector<reference<ColumnWriter>> &col_writers,
+                           vector<unique_ptr<ColumnWriterState>> &write_states) {
+	const auto next = column_ids.size();
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			if (col_writers[i].get().HasAnalyze()) {
+				col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
+			}
+		}
+	}
+
+	for (idx_t i = 0; i < next; i++) {
+		if (col_writers[i].get().HasAnalyze()) {
+			col_writers[i].get().FinalizeAnalyze(*write_states[i]);
+		}
+	}
+
+	// Reserving these once at the start really pays off
+	for (auto &write_state : write_states) {
+		write_state->definition_levels.reserve(buffer.Count());
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
+		}
+	}
+
+	for (idx_t i = 0; i < next; i++) {
+		col_writers[i].get().BeginWrite(*write_states[i]);
+	}
+
+	for (auto &chunk : buffer.Chunks({column_ids})) {
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
+		}
+	}
+}
+
+//! A set of columns of a row group that is encoded and compressed independently of the other columns
+struct ColumnPass {
+	vector<column_t> column_ids;
+	vector<reference<ColumnWriter>> col_writers;
+	vector<unique_ptr<ColumnWriterState>> write_states;
+};
+
+class PrepareColumnsTask : public BaseExecutorTask {
+public:
+	PrepareColumnsTask(TaskExecutor &executor, ColumnDataCollection &buffer, ColumnPass &pass)
+	    : BaseExecutorTask(executor), buffer(buffer), pass(pass) {
+	}
+
+	void ExecuteTask() override {
+		PrepareColumns(buffer, pass.column_ids, pass.col_writers, pass.write_states);
+	}
+
+private:
+	ColumnDataCollection &buffer;
+	ColumnPass &pass;
+};
+
+void ParquetWriter::PrepareRowGroup(ClientContext &context, ColumnDataCollection &buffer, PreparedRowGroup &result) {
 	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
 	static constexpr idx_t COLUMNS_PER_PASS = 8;
+	// Row groups smaller than this are encoded by a single thread, as the tasks would not pay off
+	static constexpr idx_t MIN_PARALLEL_ROW_GROUP_SIZE = 1ULL << 20ULL;
 
 	// We want these to be in-memory/hybrid so we don't have to copy over strings to the dictionary
 	D_ASSERT(buffer.GetAllocatorType() == ColumnDataAllocatorType::IN_MEMORY_ALLOCATOR ||
@@ -406,56 +477,46 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 	row_group.total_byte_size = NumericCast<int64_t>(buffer.SizeInBytes());
 	row_group.__isset.file_offset = true;
 
-	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
+	// when multiple threads are available, the column chunks of the row group are encoded and compressed in
+	// parallel - we then use smaller passes so every thread gets some work
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto num_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
-	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
-		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
-		vector<column_t> column_ids;
-		vector<reference<ColumnWriter>> col_writers;
-		vector<unique_ptr<ColumnWriterState>> write_states;
-		for (idx_t i = 0; i < next; i++) {
-			column_ids.emplace_back(col_idx + i);
-			col_writers.emplace_back(*column_writers[column_ids.back()]);
-			write_states.emplace_back(col_writers.back().get().InitializeWriteState(row_group));
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				if (col_writers[i].get().HasAnalyze()) {
-					col_writers[i].get().Analyze(*write_states[i], nullptr, chunk.data[i], chunk.size());
-				}
-			}
-		}
+	auto parallel = num_threads > 1 && buffer.ColumnCount() > 1 && buffer.SizeInBytes() >= MIN_PARALLEL_ROW_GROUP_SIZE;
+	idx_t columns_per_pass = COLUMNS_PER_PASS;
+	if (parallel) {
+		auto columns_per_thread = (buffer.ColumnCount() + num_threads - 1) / num_threads;
+		columns_per_pass = MinValue<idx_t>(columns_per_pass, columns_per_thread);
+	}
 
+	// the write states register their column chunks with the row group, so they are initialized in column order
+	vector<ColumnPass> passes;
+	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += columns_per_pass) {
+		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, columns_per_pass);
+		ColumnPass pass;
 		for (idx_t i = 0; i < next; i++) {
-			if (col_writers[i].get().HasAnalyze()) {
-				col_writers[i].get().FinalizeAnalyze(*write_states[i]);
-			}
+			pass.column_ids.emplace_back(col_idx + i);
+			pass.col_writers.emplace_back(*column_writers[pass.column_ids.back()]);
+			pass.write_states.emplace_back(pass.col_writers.back().get().InitializeWriteState(row_group));
 		}
+		passes.push_back(std::move(pass));
+	}
 
-		// Reserving these once at the start really pays off
-		for (auto &write_state : write_states) {
-			write_state->definition_levels.reserve(buffer.Count());
+	if (parallel && passes.size() > 1) {
+		TaskExecutor executor(scheduler);
+		for (auto &pass : passes) {
+			executor.ScheduleTask(make_uniq<PrepareColumnsTask>(executor, buffer, pass));
 		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Prepare(*write_states[i], nullptr, chunk.data[i], chunk.size());
-			}
-		}
-
-		for (idx_t i = 0; i < next; i++) {
-			col_writers[i].get().BeginWrite(*write_states[i]);
-		}
-
-		for (auto &chunk : buffer.Chunks({column_ids})) {
-			for (idx_t i = 0; i < next; i++) {
-				col_writers[i].get().Write(*write_states[i], chunk.data[i], chunk.size());
-			}
+		executor.WorkOnTasks();
+	} else {
+		for (auto &pass : passes) {
+			PrepareColumns(buffer, pass.column_ids, pass.col_writers, pass.write_states);
 		}
+	}
 
-		for (auto &write_state : write_states) {
+	auto &states = result.states;
+	for (auto &pass : passes) {
+		for (auto &write_state : pass.write_states) {
 			states.push_back(std::move(write_state));
 		}
 	}
@@ -521,13 +582,13 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 	prepared.heaps.clear();
 }
 
-void ParquetWriter::Flush(ColumnDataCollection &buffer) {
+void ParquetWriter::Flush(ClientContext &context, ColumnDataCollection &buffer) {
 	if (buffer.Count() == 0) {
 		return;
 	}
 
 	PreparedRowGroup prepared_row_group;
-	PrepareRowGroup(buffer, prepared_row_group);
+	PrepareRowGroup(context, buffer, prepared_row_group);
 	buffer.Reset();
 
 	FlushRowGroup(prepared_row_group);
@@ -21,7 +21,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), view_query(std::move(info.view_query)) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
@@ -71,6 +71,9 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
 	result->tags = tags;
+	if (view_query) {
+		result->view_query = unique_ptr_cast<SQLStatement, SelectStatement>(view_query->Copy());
+	}
 	return std::move(result);
 }
 
@@ -181,6 +184,15 @@ string TableCatalogEntry::ToSQL() const {
 	return create_info->ToString();
 }
 
+bool TableCatalogEntry::IsMaterializedView() const {
+	return view_query != nullptr;
+}
+
+const SelectStatement &TableCatalogEntry::GetViewQuery() const {
+	D_ASSERT(view_query);
+	return *view_query;
+}
+
 const ColumnList &TableCatalogEntry::GetColumns() const {
 	return columns;
 }
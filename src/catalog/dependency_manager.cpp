@@ -514,7 +514,10 @@ void DependencyManager::AlterObject(CatalogTransaction transaction, CatalogEntry
 				break;
 			}
 			case AlterTableType::ADD_COLUMN: {
-				disallow_alter = false;
+				// materialized views are maintained with the columns that the table had when they were created
+				auto dependent = LookupEntry(transaction, dep);
+				disallow_alter = dependent && dependent->type == CatalogType::TABLE_ENTRY &&
+				                 dependent->Cast<TableCatalogEntry>().IsMaterializedView();
 				break;
 			}
 			default:
@@ -596,6 +599,21 @@ void DependencyManager::Scan(
 	}
 }
 
+catalog_entry_vector_t DependencyManager::GetDependents(CatalogTransaction transaction, CatalogEntry &object) {
+	catalog_entry_vector_t result;
+	if (IsSystemEntry(object)) {
+		return result;
+	}
+	auto info = GetLookupProperties(object);
+	ScanDependents(transaction, info, [&](DependencyEntry &dep) {
+		auto entry = LookupEntry(transaction, dep);
+		if (entry) {
+			result.push_back(*entry);
+		}
+	});
+	return result;
+}
+
 void DependencyManager::AddOwnership(CatalogTransaction transaction, CatalogEntry &owner, CatalogEntry &entry) {
 	if (IsSystemEntry(entry) || IsSystemEntry(owner)) {
 		return;
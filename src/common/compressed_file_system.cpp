@@ -1,13 +1,49 @@
 #include "duckdb/common/compressed_file_system.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/queue.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
+struct CompressedFileReadAheadChunk {
+	unsafe_unique_array<data_t> data;
+	idx_t size = 0;
+	//! The position in the compressed file after decompressing this chunk
+	idx_t position = 0;
+};
+
+//! Shared state between the reader of a compressed file and the thread that decompresses ahead of it
+struct CompressedFileReadAhead {
+	mutex lock;
+	std::condition_variable cv;
+	//! The decompressed chunks that have not been handed to the reader yet
+	queue<CompressedFileReadAheadChunk> chunks;
+	//! Whether the read-ahead thread has reached the end of the file (or failed)
+	bool finished = false;
+	//! Whether the read-ahead thread should stop
+	bool stopped = false;
+	ErrorData error;
+
+	//! The chunk the reader is currently reading from (only accessed by the reader)
+	CompressedFileReadAheadChunk current;
+	idx_t current_offset = 0;
+	//! The position in the compressed file up to which the reader has consumed data
+	atomic<idx_t> progress {0};
+
+#ifndef DUCKDB_NO_THREADS
+	thread producer;
+#endif
+};
+
 StreamWrapper::~StreamWrapper() {
 }
 
 CompressedFile::CompressedFile(CompressedFileSystem &fs, unique_ptr<FileHandle> child_handle_p, const string &path)
-    : FileHandle(fs, path), compressed_fs(fs), child_handle(std::move(child_handle_p)) {
+    : FileHandle(fs, path), compressed_fs(fs), child_handle(std::move(child_handle_p)), current_position(0) {
 }
 
 CompressedFile::~CompressedFile() {
@@ -29,13 +65,130 @@ void CompressedFile::Initialize(bool write) {
 
 	stream_wrapper = compressed_fs.CreateStream();
 	stream_wrapper->Initialize(*this, write);
+	if (!write && read_ahead_chunks > 0) {
+		StartReadAhead();
+	}
 }
 
 idx_t CompressedFile::GetProgress() {
+	if (read_ahead) {
+		return read_ahead->progress;
+	}
 	return current_position;
 }
 
-int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
+void CompressedFile::EnableReadAhead(idx_t max_chunks) {
+	if (write) {
+		throw InternalException("Read-ahead can only be enabled for compressed files that are opened for reading");
+	}
+#ifndef DUCKDB_NO_THREADS
+	if (max_chunks == 0 || read_ahead_chunks > 0) {
+		return;
+	}
+	read_ahead_chunks = max_chunks;
+	// any data that was already decompressed is handed out by the read-ahead thread first
+	StartReadAhead();
+#endif
+}
+
+void CompressedFile::StartReadAhead() {
+#ifndef DUCKDB_NO_THREADS
+	D_ASSERT(!read_ahead);
+	read_ahead = make_uniq<CompressedFileReadAhead>();
+	read_ahead->progress = current_position.load();
+	auto &state = *read_ahead;
+	state.producer = thread([this, &state]() {
+		while (true) {
+			{
+				unique_lock<mutex> guard(state.lock);
+				state.cv.wait(guard, [&]() { return state.stopped || state.chunks.size() < read_ahead_chunks; });
+				if (state.stopped) {
+					return;
+				}
+			}
+			// decompress the next chunk without holding the lock
+			CompressedFileReadAheadChunk chunk;
+			ErrorData error;
+			try {
+				chunk.data = make_unsafe_uniq_array<data_t>(READ_AHEAD_CHUNK_SIZE);
+				chunk.size = NumericCast<idx_t>(ReadStream(chunk.data.get(), READ_AHEAD_CHUNK_SIZE));
+				chunk.position = current_position;
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+			// a partial chunk means we have reached the end of the file
+			bool finished = error.HasError() || chunk.size < READ_AHEAD_CHUNK_SIZE;
+			lock_guard<mutex> guard(state.lock);
+			if (chunk.size > 0) {
+				state.chunks.push(std::move(chunk));
+			}
+			if (finished) {
+				state.error = std::move(error);
+				state.finished = true;
+			}
+			state.cv.notify_all();
+			if (finished) {
+				return;
+			}
+		}
+	});
+#endif
+}
+
+void CompressedFile::StopReadAhead() {
+	if (!read_ahead) {
+		return;
+	}
+#ifndef DUCKDB_NO_THREADS
+	{
+		lock_guard<mutex> guard(read_ahead->lock);
+		read_ahead->stopped = true;
+		read_ahead->cv.notify_all();
+	}
+	read_ahead->producer.join();
+#endif
+	read_ahead.reset();
+}
+
+int64_t CompressedFile::ReadData(void *buffer, int64_t nr_bytes) {
+	if (read_ahead) {
+		return ReadAheadData(buffer, nr_bytes);
+	}
+	return ReadStream(data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes));
+}
+
+int64_t CompressedFile::ReadAheadData(void *buffer, int64_t nr_bytes) {
+	auto &state = *read_ahead;
+	auto remaining = NumericCast<idx_t>(nr_bytes);
+	idx_t total_read = 0;
+	while (remaining > 0) {
+		if (state.current_offset == state.current.size) {
+			// the current chunk is exhausted: wait for the read-ahead thread to hand over the next one
+			unique_lock<mutex> guard(state.lock);
+			state.cv.wait(guard, [&]() { return !state.chunks.empty() || state.finished; });
+			if (state.chunks.empty()) {
+				if (state.error.HasError()) {
+					state.error.Throw();
+				}
+				break;
+			}
+			state.current = std::move(state.chunks.front());
+			state.chunks.pop();
+			state.current_offset = 0;
+			state.progress = state.current.position;
+			state.cv.notify_all();
+		}
+		auto available = MinValue<idx_t>(remaining, state.current.size - state.current_offset);
+		memcpy(data_ptr_cast(buffer) + total_read, state.current.data.get() + state.current_offset, available);
+		state.current_offset += available;
+		total_read += available;
+		remaining -= available;
+	}
+	return UnsafeNumericCast<int64_t>(total_read);
+}
+
+int64_t CompressedFile::ReadStream(data_ptr_t buffer, idx_t nr_bytes) {
+	auto remaining = UnsafeNumericCast<int64_t>(nr_bytes);
 	idx_t total_read = 0;
 	while (true) {
 		// first check if there are input bytes available in the output buffers
@@ -108,6 +261,7 @@ int64_t CompressedFile::WriteData(data_ptr_t buffer, int64_t nr_bytes) {
 }
 
 void CompressedFile::Close() {
+	StopReadAhead();
 	if (stream_wrapper) {
 		stream_wrapper->Close();
 		stream_wrapper.reset();
@@ -135,6 +289,8 @@ int64_t CompressedFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr
 
 void CompressedFileSystem::Reset(FileHandle &handle) {
 	auto &compressed_file = handle.Cast<CompressedFile>();
+	// close the stream first, so that a read-ahead thread is no longer reading from the child handle
+	compressed_file.Close();
 	compressed_file.child_handle->Reset();
 	compressed_file.Initialize(compressed_file.write);
 }
@@ -4453,6 +4453,12 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPTIMIZER_EXTENSION";
 	case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
 		return "OPTIMIZER_MATERIALIZED_CTE";
+	case MetricsType::OPTIMIZER_COMMON_SUBPLAN:
+		return "OPTIMIZER_COMMON_SUBPLAN";
+	case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
+		return "OPTIMIZER_LATE_MATERIALIZATION";
+	case MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN:
+		return "OPTIMIZER_AGGREGATE_PUSHDOWN";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4586,6 +4592,15 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPTIMIZER_MATERIALIZED_CTE")) {
 		return MetricsType::OPTIMIZER_MATERIALIZED_CTE;
 	}
+	if (StringUtil::Equals(value, "OPTIMIZER_COMMON_SUBPLAN")) {
+		return MetricsType::OPTIMIZER_COMMON_SUBPLAN;
+	}
+	if (StringUtil::Equals(value, "OPTIMIZER_LATE_MATERIALIZATION")) {
+		return MetricsType::OPTIMIZER_LATE_MATERIALIZATION;
+	}
+	if (StringUtil::Equals(value, "OPTIMIZER_AGGREGATE_PUSHDOWN")) {
+		return MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -4881,6 +4896,12 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "EXTENSION";
 	case OptimizerType::MATERIALIZED_CTE:
 		return "MATERIALIZED_CTE";
+	case OptimizerType::COMMON_SUBPLAN:
+		return "COMMON_SUBPLAN";
+	case OptimizerType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
+	case OptimizerType::AGGREGATE_PUSHDOWN:
+		return "AGGREGATE_PUSHDOWN";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4960,6 +4981,15 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "MATERIALIZED_CTE")) {
 		return OptimizerType::MATERIALIZED_CTE;
 	}
+	if (StringUtil::Equals(value, "COMMON_SUBPLAN")) {
+		return OptimizerType::COMMON_SUBPLAN;
+	}
+	if (StringUtil::Equals(value, "LATE_MATERIALIZATION")) {
+		return OptimizerType::LATE_MATERIALIZATION;
+	}
+	if (StringUtil::Equals(value, "AGGREGATE_PUSHDOWN")) {
+		return OptimizerType::AGGREGATE_PUSHDOWN;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
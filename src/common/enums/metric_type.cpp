@@ -36,6 +36,9 @@ profiler_settings_t MetricsUtils::GetOptimizerMetrics() {
         MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN,
         MetricsType::OPTIMIZER_EXTENSION,
         MetricsType::OPTIMIZER_MATERIALIZED_CTE,
+        MetricsType::OPTIMIZER_COMMON_SUBPLAN,
+        MetricsType::OPTIMIZER_LATE_MATERIALIZATION,
+        MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN,
     };
 }
 
@@ -100,6 +103,12 @@ MetricsType MetricsUtils::GetOptimizerMetricByType(OptimizerType type) {
             return MetricsType::OPTIMIZER_EXTENSION;
         case OptimizerType::MATERIALIZED_CTE:
             return MetricsType::OPTIMIZER_MATERIALIZED_CTE;
+        case OptimizerType::COMMON_SUBPLAN:
+            return MetricsType::OPTIMIZER_COMMON_SUBPLAN;
+        case OptimizerType::LATE_MATERIALIZATION:
+            return MetricsType::OPTIMIZER_LATE_MATERIALIZATION;
+        case OptimizerType::AGGREGATE_PUSHDOWN:
+            return MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN;
        default:
             throw InternalException("OptimizerType %s cannot be converted to a MetricsType", EnumUtil::ToString(type));
     };
@@ -153,6 +162,12 @@ OptimizerType MetricsUtils::GetOptimizerTypeByMetric(MetricsType type) {
             return OptimizerType::EXTENSION;
         case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
             return OptimizerType::MATERIALIZED_CTE;
+        case MetricsType::OPTIMIZER_COMMON_SUBPLAN:
+            return OptimizerType::COMMON_SUBPLAN;
+        case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
+            return OptimizerType::LATE_MATERIALIZATION;
+        case MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN:
+            return OptimizerType::AGGREGATE_PUSHDOWN;
     default:
             return OptimizerType::INVALID;
     };
@@ -183,6 +198,9 @@ bool MetricsUtils::IsOptimizerMetric(MetricsType type) {
         case MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN:
         case MetricsType::OPTIMIZER_EXTENSION:
         case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
+        case MetricsType::OPTIMIZER_COMMON_SUBPLAN:
+        case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
+        case MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN:
             return true;
         default:
             return false;
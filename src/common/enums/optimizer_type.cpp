@@ -35,6 +35,9 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"join_filter_pushdown", OptimizerType::JOIN_FILTER_PUSHDOWN},
     {"extension", OptimizerType::EXTENSION},
     {"materialized_cte", OptimizerType::MATERIALIZED_CTE},
+    {"common_subplan", OptimizerType::COMMON_SUBPLAN},
+    {"late_materialization", OptimizerType::LATE_MATERIALIZATION},
+    {"aggregate_pushdown", OptimizerType::AGGREGATE_PUSHDOWN},
     {nullptr, OptimizerType::INVALID}};
 
 string OptimizerTypeToString(OptimizerType type) {
@@ -285,8 +285,9 @@ void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &re
 #ifdef DEBUG
 	groups.Verify();
 	D_ASSERT(groups.ColumnCount() + 1 == layout.ColumnCount());
+	D_ASSERT(result.ColumnCount() == layout.GetAggregates().size());
 	for (idx_t i = 0; i < result.ColumnCount(); i++) {
-		D_ASSERT(result.data[i].GetType() == payload_types[i]);
+		D_ASSERT(result.data[i].GetType().InternalType() == layout.GetAggregates()[i].return_type);
 	}
 #endif
 
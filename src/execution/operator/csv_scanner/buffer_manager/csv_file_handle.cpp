@@ -53,6 +53,13 @@ bool CSVFileHandle::OnDiskFile() {
 	return on_disk_file;
 }
 
+void CSVFileHandle::EnableReadAhead() {
+	if (compression_type == FileCompressionType::UNCOMPRESSED || is_pipe) {
+		return;
+	}
+	file_handle->Cast<CompressedFile>().EnableReadAhead();
+}
+
 void CSVFileHandle::Reset() {
 	file_handle->Reset();
 	finished = false;
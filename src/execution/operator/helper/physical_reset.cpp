@@ -3,6 +3,8 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 
 namespace duckdb {
 
@@ -13,6 +15,8 @@ void PhysicalReset::ResetExtensionVariable(ExecutionContext &context, DBConfig &
 	}
 	if (scope == SetScope::GLOBAL) {
 		config.ResetOption(name);
+		PlanCache::Get(context.client).Clear();
+		QueryResultCache::Get(context.client).Clear();
 	} else {
 		auto &client_config = ClientConfig::GetConfig(context.client);
 		client_config.set_variables[name] = extension_option.default_value;
@@ -58,6 +62,8 @@ SourceResultType PhysicalReset::GetData(ExecutionContext &context, DataChunk &ch
 		}
 		auto &db = DatabaseInstance::GetDatabase(context.client);
 		config.ResetOption(&db, *option);
+		PlanCache::Get(context.client).Clear();
+		QueryResultCache::Get(context.client).Clear();
 		break;
 	}
 	case SetScope::SESSION:
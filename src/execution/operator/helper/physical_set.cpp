@@ -3,6 +3,8 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 
 namespace duckdb {
 
@@ -16,6 +18,9 @@ void PhysicalSet::SetExtensionVariable(ClientContext &context, ExtensionOption &
 	}
 	if (scope == SetScope::GLOBAL) {
 		config.SetOption(name, std::move(target_value));
+		// cached plans and results might depend on the old value
+		PlanCache::Get(context).Clear();
+		QueryResultCache::Get(context).Clear();
 	} else {
 		auto &client_config = ClientConfig::GetConfig(context);
 		client_config.set_variables[name] = std::move(target_value);
@@ -57,6 +62,9 @@ SourceResultType PhysicalSet::GetData(ExecutionContext &context, DataChunk &chun
 		auto &db = DatabaseInstance::GetDatabase(context.client);
 		auto &config = DBConfig::GetConfig(context.client);
 		config.SetOption(&db, *option, input_val);
+		// cached plans and results might depend on the old value
+		PlanCache::Get(context.client).Clear();
+		QueryResultCache::Get(context.client).Clear();
 		break;
 	}
 	case SetScope::SESSION:
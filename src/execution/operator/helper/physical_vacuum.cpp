@@ -3,6 +3,8 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/value_distribution.hpp"
+#include "duckdb/execution/reservoir_sample.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 namespace duckdb {
@@ -48,10 +50,28 @@ public:
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+
+	//! The columns of which the value distribution is computed
+	vector<column_t> distribution_columns;
+	vector<LogicalType> distribution_types;
+	//! The sample of the values of these columns
+	mutex sample_lock;
+	unique_ptr<ReservoirSample> sample;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<VacuumGlobalSinkState>(*info, table);
+	auto result = make_uniq<VacuumGlobalSinkState>(*info, table);
+	for (idx_t col_idx = 0; col_idx < info->columns.size(); col_idx++) {
+		auto type = table->GetColumn(info->columns[col_idx]).GetType();
+		if (ValueDistribution::TypeIsSupported(type)) {
+			result->distribution_columns.push_back(col_idx);
+			result->distribution_types.push_back(type);
+		}
+	}
+	if (!result->distribution_columns.empty()) {
+		result->sample = make_uniq<ReservoirSample>(Allocator::Get(context), ValueDistribution::SAMPLE_SIZE);
+	}
+	return std::move(result);
 }
 
 SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
@@ -65,6 +85,15 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk,
 		lstate.column_distinct_stats[col_idx]->Update(chunk.data[col_idx], chunk.size(), false);
 	}
 
+	auto &gstate = input.global_state.Cast<VacuumGlobalSinkState>();
+	if (gstate.sample) {
+		DataChunk sample_chunk;
+		sample_chunk.InitializeEmpty(gstate.distribution_types);
+		sample_chunk.ReferenceColumns(chunk, gstate.distribution_columns);
+		lock_guard<mutex> guard(gstate.sample_lock);
+		gstate.sample->AddToReservoir(sample_chunk);
+	}
+
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -93,6 +122,18 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
+	if (sink.sample) {
+		// compute the value distributions of the columns from the sample
+		sink.sample->Finalize();
+		if (sink.sample->reservoir_chunk) {
+			auto &rows = sink.sample->reservoir_chunk->chunk;
+			for (idx_t i = 0; i < sink.distribution_columns.size(); i++) {
+				auto distribution = ValueDistribution::Create(rows.data[i], rows.size());
+				tbl->GetStorage().SetValueDistribution(column_id_map.at(sink.distribution_columns[i]),
+				                                       std::move(distribution));
+			}
+		}
+	}
 
 	return SinkFinalizeType::READY;
 }
@@ -1,12 +1,14 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/parallel/interrupt.hpp"
@@ -14,6 +16,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -102,7 +105,11 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
                                                                          const PhysicalOperator &op) const {
 	// clear any previously set filters
 	// we can have previous filters for this operator in case of e.g. recursive CTEs
-	dynamic_filters->ClearFilters(op);
+	for (auto &filter : filters) {
+		for (auto &target : filter.targets) {
+			target.dynamic_filters->ClearFilters(op);
+		}
+	}
 	auto result = make_uniq<JoinFilterGlobalState>();
 	result->global_aggregate_state =
 	    make_uniq<GlobalUngroupedAggregateState>(BufferAllocator::Get(context), min_max_aggregates);
@@ -560,7 +567,39 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+unique_ptr<TableFilter> JoinFilterPushdownInfo::GetMembershipFilter(ClientContext &context, JoinHashTable &ht,
+                                                                    idx_t join_condition) const {
+	if (ht.Count() > ClientConfig::GetConfig(context).dynamic_or_filter_threshold) {
+		return nullptr;
+	}
+	// the build side is small: collect the distinct values of the join condition
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, vector<column_t> {join_condition});
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	value_set_t values;
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+			auto value = keys.data[0].GetValue(row_idx);
+			if (!value.IsNull()) {
+				values.insert(std::move(value));
+			}
+		}
+	}
+	if (values.size() <= 1) {
+		// a single value is already covered by the min/max filter
+		return nullptr;
+	}
+	auto or_filter = make_uniq<ConjunctionOrFilter>();
+	for (auto &value : values) {
+		or_filter->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, value));
+	}
+	return std::move(or_filter);
+}
+
+void JoinFilterPushdownInfo::PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -571,10 +610,9 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 
 	gstate.global_aggregate_state->Finalize(final_min_max);
 
-	// create a filter for each of the aggregates
+	// create the filters for each of the aggregates
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
-		auto filter_col_idx = filter.probe_column_index.column_index;
 		auto min_idx = filter_idx * 2;
 		auto max_idx = min_idx + 1;
 
@@ -586,20 +624,31 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// table e.g. because they are part of a RIGHT join
 			continue;
 		}
+		vector<unique_ptr<TableFilter>> table_filters;
 		if (Value::NotDistinctFrom(min_val, max_val)) {
 			// min = max - generate an equality filter
-			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+			table_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val)));
 		} else {
 			// min != max - generate a range filter
-			auto greater_equals =
-			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
-			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			table_filters.push_back(
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val)));
+			table_filters.push_back(
+			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val)));
+			// if there are only a few values, also filter on the values themselves
+			auto membership_filter = GetMembershipFilter(context, ht, filter.join_condition);
+			if (membership_filter) {
+				table_filters.push_back(std::move(membership_filter));
+			}
 		}
 		// not null filter
-		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		table_filters.push_back(make_uniq<IsNotNullFilter>());
+
+		// push the filters into every scan that the join condition was transferred to
+		for (auto &target : filter.targets) {
+			for (auto &table_filter : table_filters) {
+				target.dynamic_filters->PushFilter(op, target.column_index, table_filter->Copy());
+			}
+		}
 	}
 }
 
@@ -608,6 +657,17 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	if (!cardinality_feedback_key.empty()) {
+		// the build side is materialized: remember its cardinality if it was misestimated
+		// the rows are still in the sink collections of the thread-local hash tables at this point
+		idx_t build_count = 0;
+		for (auto &local_ht : sink.local_hash_tables) {
+			build_count += local_ht->GetSinkCollection().Count();
+		}
+		CardinalityFeedback::Get(context).Record(context, cardinality_feedback_key, children[1]->estimated_cardinality,
+		                                         build_count);
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -646,7 +706,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(context, ht, *sink.global_filter_state, *this);
 	}
 
 	// check for possible perfect hash table
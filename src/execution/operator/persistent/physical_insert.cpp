@@ -524,6 +524,8 @@ SinkCombineResultType PhysicalInsert::Combine(ExecutionContext &context, Operato
 		storage.FinalizeLocalAppend(gstate.append_state);
 	} else {
 		// we have written rows to disk optimistically - merge directly into the transaction-local storage
+		// flush the last row group as well, so that it is compressed by this thread instead of during the checkpoint
+		lstate.writer->WriteLastRowGroup(*lstate.local_collection);
 		gstate.table.GetStorage().LocalMerge(context.client, *lstate.local_collection);
 		gstate.table.GetStorage().FinalizeOptimisticWriter(context.client, *lstate.writer);
 	}
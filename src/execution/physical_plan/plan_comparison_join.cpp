@@ -8,6 +8,7 @@
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/operator/subtract.hpp"
@@ -161,6 +162,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	D_ASSERT(op.children.size() == 2);
 	idx_t lhs_cardinality = op.children[0]->EstimateCardinality(context);
 	idx_t rhs_cardinality = op.children[1]->EstimateCardinality(context);
+	// the key of the build side has to be computed before planning moves the expressions out of the operators
+	string build_feedback_key;
+	if (CardinalityFeedback::Enabled(context)) {
+		build_feedback_key = CardinalityFeedback::GetKey(context, *op.children[1]);
+	}
 	auto left = CreatePlan(*op.children[0]);
 	auto right = CreatePlan(*op.children[1]);
 	left->estimated_cardinality = lhs_cardinality;
@@ -202,6 +208,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		    make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions), op.join_type,
 		                                op.left_projection_map, op.right_projection_map, std::move(op.mark_types),
 		                                op.estimated_cardinality, perfect_join_stats, std::move(op.filter_pushdown));
+		plan->Cast<PhysicalHashJoin>().cardinality_feedback_key = std::move(build_feedback_key);
 
 	} else {
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
@@ -16,6 +16,7 @@ unique_ptr<ReservoirChunk> ReservoirChunk::Deserialize(Deserializer &deserialize
 
 ReservoirSample::ReservoirSample(Allocator &allocator, idx_t sample_count, int64_t seed)
     : BlockingSample(seed), allocator(allocator), sample_count(sample_count), reservoir_initialized(false) {
+	type = SampleType::RESERVOIR_SAMPLE;
 }
 
 ReservoirSample::ReservoirSample(idx_t sample_count, int64_t seed)
@@ -64,6 +65,12 @@ void ReservoirSample::AddToReservoir(DataChunk &input) {
 }
 
 unique_ptr<DataChunk> ReservoirSample::GetChunk() {
+	if (!reservoir_data_chunk && reservoir_chunk) {
+		// the sample was finalized or deserialized: the rows are in the reservoir chunk
+		reservoir_data_chunk = make_uniq<DataChunk>();
+		reservoir_data_chunk->Move(reservoir_chunk->chunk);
+		reservoir_chunk.reset();
+	}
 	if (!reservoir_data_chunk || reservoir_data_chunk->size() == 0) {
 		return nullptr;
 	}
@@ -152,12 +159,19 @@ idx_t ReservoirSample::FillReservoir(DataChunk &input) {
 }
 
 void ReservoirSample::Finalize() {
-	return;
+	if (!reservoir_data_chunk) {
+		return;
+	}
+	// move the rows into the reservoir chunk, which is what is serialized
+	reservoir_chunk = make_uniq<ReservoirChunk>();
+	reservoir_chunk->chunk.Move(*reservoir_data_chunk);
+	reservoir_data_chunk.reset();
 }
 
 ReservoirSamplePercentage::ReservoirSamplePercentage(Allocator &allocator, double percentage, int64_t seed)
     : BlockingSample(seed), allocator(allocator), sample_percentage(percentage / 100.0), current_count(0),
       is_finalized(false) {
+	type = SampleType::RESERVOIR_PERCENTAGE_SAMPLE;
 	reservoir_sample_size = idx_t(sample_percentage * RESERVOIR_THRESHOLD);
 	current_sample = make_uniq<ReservoirSample>(allocator, reservoir_sample_size, random.NextRandomInteger());
 }
@@ -16,6 +16,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
@@ -33,7 +34,12 @@ unique_ptr<CSVFileHandle> ReadCSV::OpenCSV(const string &file_path, FileCompress
                                            ClientContext &context) {
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto &allocator = BufferAllocator::Get(context);
-	return CSVFileHandle::OpenFile(fs, allocator, file_path, compression);
+	auto file_handle = CSVFileHandle::OpenFile(fs, allocator, file_path, compression);
+	if (TaskScheduler::GetScheduler(context).NumberOfThreads() > 1) {
+		// compressed files can only be read sequentially, overlap their decompression with parsing
+		file_handle->EnableReadAhead();
+	}
+	return file_handle;
 }
 
 ReadCSVData::ReadCSVData() {
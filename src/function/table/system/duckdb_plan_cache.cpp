@@ -0,0 +1,66 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/plan_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBPlanCacheData : public GlobalTableFunctionState {
+	DuckDBPlanCacheData() : finished(false) {
+	}
+
+	PlanCacheStats stats;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBPlanCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("max_entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBPlanCacheInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBPlanCacheData>();
+	result->stats = PlanCache::Get(context).GetStats();
+	return std::move(result);
+}
+
+void DuckDBPlanCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBPlanCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	idx_t col = 0;
+	// hits, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.hits));
+	// misses, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.misses));
+	// evictions, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.evictions));
+	// entries, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.entries));
+	// max_entries, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.max_entries));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBPlanCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_plan_cache", {}, DuckDBPlanCacheFunction, DuckDBPlanCacheBind, DuckDBPlanCacheInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,72 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryResultCacheData : public GlobalTableFunctionState {
+	DuckDBQueryResultCacheData() : finished(false) {
+	}
+
+	QueryResultCacheStats stats;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("entries");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("memory_limit_bytes");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryResultCacheInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryResultCacheData>();
+	result->stats = QueryResultCache::Get(context).GetStats();
+	return std::move(result);
+}
+
+void DuckDBQueryResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryResultCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	idx_t col = 0;
+	// hits, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.hits));
+	// misses, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.misses));
+	// evictions, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.evictions));
+	// entries, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.entries));
+	// memory_usage_bytes, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.memory_usage));
+	// memory_limit_bytes, UBIGINT
+	output.SetValue(col++, 0, Value::UBIGINT(data.stats.memory_limit));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBQueryResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_result_cache", {}, DuckDBQueryResultCacheFunction,
+	                              DuckDBQueryResultCacheBind, DuckDBQueryResultCacheInit));
+}
+
+} // namespace duckdb
@@ -29,6 +29,8 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	DuckDBExtensionsFun::RegisterFunction(*this);
 	DuckDBMemoryFun::RegisterFunction(*this);
 	DuckDBOptimizersFun::RegisterFunction(*this);
+	DuckDBPlanCacheFun::RegisterFunction(*this);
+	DuckDBQueryResultCacheFun::RegisterFunction(*this);
 	DuckDBSecretsFun::RegisterFunction(*this);
 	DuckDBWhichSecretFun::RegisterFunction(*this);
 	DuckDBSequencesFun::RegisterFunction(*this);
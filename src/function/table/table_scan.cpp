@@ -222,6 +222,12 @@ struct IndexScanGlobalState : public GlobalTableFunctionState {
 	TableScanState local_storage_state;
 	vector<storage_t> column_ids;
 	bool finished;
+	//! The checkpoint lock of the table, which keeps the row ids valid while they are fetched
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	//! Whether or not the row ids are stale because the table was vacuumed after they were collected, in which case
+	//! the table is scanned instead (the filters of the index scan are still applied after the scan)
+	bool scan_table = false;
+	TableScanState table_scan_state;
 };
 
 static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
@@ -241,8 +247,19 @@ static unique_ptr<GlobalTableFunctionState> IndexScanInitGlobal(ClientContext &c
 		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
 	}
 
+	auto &storage = bind_data.table.GetStorage();
+	result->checkpoint_lock = storage.GetSharedCheckpointLock();
+	if (storage.GetDataTableInfo()->GetVacuumCount() != bind_data.vacuum_count) {
+		result->checkpoint_lock.reset();
+		result->scan_table = true;
+		auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+		storage.InitializeScan(transaction, result->table_scan_state, result->column_ids, input.filters.get());
+		result->finished = true;
+		return std::move(result);
+	}
+
 	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
-	local_storage.InitializeScan(bind_data.table.GetStorage(), result->local_storage_state.local_state, input.filters);
+	local_storage.InitializeScan(storage, result->local_storage_state.local_state, input.filters);
 
 	result->finished = false;
 	return std::move(result);
@@ -254,6 +271,10 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
 	auto &local_storage = LocalStorage::Get(transaction);
 
+	if (state.scan_table) {
+		bind_data.table.GetStorage().Scan(transaction, output, state.table_scan_state);
+		return;
+	}
 	if (!state.finished) {
 		auto remaining = state.row_ids_count - state.row_ids_offset;
 		auto scan_count = remaining < STANDARD_VECTOR_SIZE ? remaining : STANDARD_VECTOR_SIZE;
@@ -272,6 +293,67 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Row Id Fetch
+//===--------------------------------------------------------------------===//
+struct RowIdFetchLocalState : public LocalTableFunctionState {
+	vector<storage_t> column_ids;
+	ColumnFetchState fetch_state;
+	//! The rows fetched from either the table or the transaction-local storage
+	DataChunk fetch_chunk;
+};
+
+static unique_ptr<LocalTableFunctionState> RowIdFetchInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *gstate) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto result = make_uniq<RowIdFetchLocalState>();
+	vector<LogicalType> types;
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+		types.push_back(id == COLUMN_IDENTIFIER_ROW_ID ? LogicalType::ROW_TYPE
+		                                               : bind_data.table.GetColumn(LogicalIndex(id)).Type());
+	}
+	result->fetch_chunk.Initialize(context.client, types);
+	return std::move(result);
+}
+
+static OperatorResultType RowIdFetchFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                             DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.local_state->Cast<RowIdFetchLocalState>();
+	auto &storage = bind_data.table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context.client, bind_data.table.catalog);
+
+	auto &row_ids = input.data[0];
+	row_ids.Flatten(input.size());
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+	// the rows are emitted in the order of the input
+	// fetch consecutive rows that are either all committed or all transaction-local at once
+	idx_t start = 0;
+	while (start < input.size()) {
+		auto is_local = row_id_data[start] >= MAX_ROW_ID;
+		idx_t end = start + 1;
+		while (end < input.size() && (row_id_data[end] >= MAX_ROW_ID) == is_local) {
+			end++;
+		}
+		Vector run_row_ids(row_ids, start, end);
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			LocalStorage::Get(transaction).FetchChunk(storage, run_row_ids, end - start, state.column_ids,
+			                                          state.fetch_chunk, state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, state.column_ids, run_row_ids, end - start,
+			              state.fetch_state);
+		}
+		if (state.fetch_chunk.size() != end - start) {
+			throw InternalException("Row id fetch could not find all rows of the table");
+		}
+		output.Append(state.fetch_chunk);
+		start = end;
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -357,6 +439,7 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 				// Check if we can use an index scan, and already retrieve the matching row ids.
 				if (art_index.Scan(*index_state, max_count, bind_data.row_ids)) {
 					bind_data.is_index_scan = true;
+					bind_data.vacuum_count = info->GetVacuumCount();
 					get.function = TableScanFunction::GetIndexScanFunction();
 					return true;
 				}
@@ -422,6 +505,17 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetRowIdFetchFunction() {
+	TableFunction fetch_function("rowid_fetch", {LogicalType::ROW_TYPE}, nullptr);
+	fetch_function.init_local = RowIdFetchInitLocal;
+	fetch_function.in_out_function = RowIdFetchFunction;
+	fetch_function.statistics = TableScanStatistics;
+	fetch_function.to_string = TableScanToString;
+	// the function is only planned by the optimizer, and cannot be looked up in the catalog
+	fetch_function.verify_serialization = false;
+	return fetch_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
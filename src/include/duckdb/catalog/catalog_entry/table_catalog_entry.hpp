@@ -14,6 +14,7 @@
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/planner/bound_constraint.hpp"
 #include "duckdb/planner/expression.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
 #include "duckdb/catalog/catalog_entry/column_dependency_manager.hpp"
@@ -96,6 +97,11 @@ public:
 		return false;
 	}
 
+	//! Whether or not the table is a materialized view
+	DUCKDB_API bool IsMaterializedView() const;
+	//! Returns the query of the materialized view
+	DUCKDB_API const SelectStatement &GetViewQuery() const;
+
 	DUCKDB_API static string ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints);
 
 	//! Returns a list of segment information for this table, if exists
@@ -112,5 +118,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The query of the materialized view, if the table is a materialized view
+	unique_ptr<SelectStatement> view_query;
 };
 } // namespace duckdb
@@ -90,6 +90,8 @@ public:
 	          const std::function<void(CatalogEntry &, CatalogEntry &, const DependencyDependentFlags &)> &callback);
 
 	void AddOwnership(CatalogTransaction transaction, CatalogEntry &owner, CatalogEntry &entry);
+	//! Returns the entries that depend on the given entry
+	catalog_entry_vector_t GetDependents(CatalogTransaction transaction, CatalogEntry &object);
 
 private:
 	DuckCatalog &catalog;
@@ -10,9 +10,11 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/atomic.hpp"
 
 namespace duckdb {
 class CompressedFile;
+struct CompressedFileReadAhead;
 
 struct StreamData {
 	// various buffers & pointers
@@ -57,6 +59,12 @@ public:
 };
 
 class CompressedFile : public FileHandle {
+public:
+	//! The amount of decompressed data that is handed over from the read-ahead thread at a time
+	static constexpr idx_t READ_AHEAD_CHUNK_SIZE = 1ULL << 20ULL;
+	//! The default amount of decompressed chunks the read-ahead thread can run ahead of the reader
+	static constexpr idx_t DEFAULT_READ_AHEAD_CHUNKS = 4;
+
 public:
 	DUCKDB_API CompressedFile(CompressedFileSystem &fs, unique_ptr<FileHandle> child_handle_p, const string &path);
 	DUCKDB_API ~CompressedFile() override;
@@ -74,10 +82,23 @@ public:
 	DUCKDB_API int64_t ReadData(void *buffer, int64_t nr_bytes);
 	DUCKDB_API int64_t WriteData(data_ptr_t buffer, int64_t nr_bytes);
 	DUCKDB_API void Close() override;
+	//! Decompresses the file in a background thread, so that decompression overlaps with the processing of the
+	//! decompressed data. The thread runs at most max_chunks chunks ahead of the reader. Only valid for reading.
+	DUCKDB_API void EnableReadAhead(idx_t max_chunks = DEFAULT_READ_AHEAD_CHUNKS);
+
+private:
+	//! Reads and decompresses data from the child handle
+	int64_t ReadStream(data_ptr_t buffer, idx_t nr_bytes);
+	int64_t ReadAheadData(void *buffer, int64_t nr_bytes);
+	void StartReadAhead();
+	void StopReadAhead();
 
 private:
-	idx_t current_position = 0;
+	atomic<idx_t> current_position;
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! The amount of chunks the read-ahead thread can run ahead, or 0 if read-ahead is disabled
+	idx_t read_ahead_chunks = 0;
+	unique_ptr<CompressedFileReadAhead> read_ahead;
 };
 
 } // namespace duckdb
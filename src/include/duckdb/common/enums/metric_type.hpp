@@ -62,6 +62,9 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_JOIN_FILTER_PUSHDOWN,
     OPTIMIZER_EXTENSION,
     OPTIMIZER_MATERIALIZED_CTE,
+    OPTIMIZER_COMMON_SUBPLAN,
+    OPTIMIZER_LATE_MATERIALIZATION,
+    OPTIMIZER_AGGREGATE_PUSHDOWN,
 };
 
 struct MetricsTypeHashFunction {
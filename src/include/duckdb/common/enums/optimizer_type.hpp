@@ -38,6 +38,9 @@ enum class OptimizerType : uint32_t {
 	JOIN_FILTER_PUSHDOWN,
 	EXTENSION,
 	MATERIALIZED_CTE,
+	COMMON_SUBPLAN,
+	LATE_MATERIALIZATION,
+	AGGREGATE_PUSHDOWN,
 };
 
 string OptimizerTypeToString(OptimizerType type);
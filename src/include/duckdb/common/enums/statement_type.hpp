@@ -67,7 +67,8 @@ class ClientContext;
 struct StatementProperties {
 	StatementProperties()
 	    : requires_valid_transaction(true), allow_stream_result(false), bound_all_parameters(true),
-	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false) {
+	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false),
+	      has_volatile_functions(false) {
 	}
 
 	struct CatalogIdentity {
@@ -100,6 +101,8 @@ struct StatementProperties {
 	idx_t parameter_count;
 	//! Whether or not the statement ALWAYS requires a rebind
 	bool always_require_rebind;
+	//! Whether or not the statement calls volatile functions (e.g. random), so its result differs between runs
+	bool has_volatile_functions;
 
 	bool IsReadOnly() {
 		return modified_databases.empty();
@@ -13,6 +13,7 @@
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/bit_utils.hpp"
 
 namespace duckdb {
 
@@ -142,8 +143,56 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline static bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	//! Returns a mask with the high bit set for every byte of v that is equal to the (replicated) character c
+	//! The mask is exact for every byte (no false positives after a match), so it can be used to locate the matches
+	inline static uint64_t MatchingBytes(uint64_t v, uint64_t c) {
+		const uint64_t x = v ^ c;
+		const uint64_t low_bits = UINT64_C(0x7F7F7F7F7F7F7F7F);
+		return ~(((x & low_bits) + low_bits) | x | low_bits);
+	}
+
+	//! Gathers the high bit of every byte of the mask into a single byte (bit i is the high bit of byte i)
+	inline static uint64_t GatherHighBits(uint64_t mask) {
+		return ((mask >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+	}
+
+	template <idx_t N>
+	inline static uint64_t MatchingBytes(uint64_t v, const uint64_t (&characters)[N]) {
+		uint64_t matches = 0;
+		for (idx_t i = 0; i < N; i++) {
+			matches |= MatchingBytes(v, characters[i]);
+		}
+		return matches;
+	}
+
+	//! Returns the position of the first byte in [pos, end) that is one of the (replicated) characters
+	//! The buffer is scanned in blocks of 64 bytes, for which a structural bitmap with one bit per byte is built, and
+	//! then in words of 8 bytes. The last (up to) 8 bytes are not scanned, the position of the first of these bytes
+	//! is returned if no character was found before them.
+	template <idx_t N>
+	inline static idx_t NextStructuralCharacter(const char *buffer, idx_t pos, idx_t end,
+	                                            const uint64_t (&characters)[N]) {
+		static constexpr idx_t BLOCK_SIZE = 64;
+		while (pos + BLOCK_SIZE < end) {
+			uint64_t bitmap = 0;
+			for (idx_t word_idx = 0; word_idx < BLOCK_SIZE / sizeof(uint64_t); word_idx++) {
+				auto value =
+				    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(buffer + pos + word_idx * sizeof(uint64_t)));
+				bitmap |= GatherHighBits(MatchingBytes(value, characters)) << (word_idx * 8);
+			}
+			if (bitmap) {
+				return pos + CountZeros<uint64_t>::Trailing(bitmap);
+			}
+			pos += BLOCK_SIZE;
+		}
+		while (pos + sizeof(uint64_t) < end) {
+			auto matches = MatchingBytes(Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(buffer + pos)), characters);
+			if (matches) {
+				return pos + CountZeros<uint64_t>::Trailing(matches) / 8;
+			}
+			pos += sizeof(uint64_t);
+		}
+		return pos;
 	}
 
 	//! Process one chunk
@@ -236,14 +285,12 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
+				{
+					auto &transition_array = state_machine->transition_array;
+					const uint64_t characters[] = {transition_array.quote, transition_array.escape,
+					                               transition_array.new_line, transition_array.carriage_return};
+					iterator.pos.buffer_pos =
+					    NextStructuralCharacter(buffer_handle_ptr, iterator.pos.buffer_pos, to_pos, characters);
 				}
 
 				while (state_machine->transition_array
@@ -258,16 +305,12 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return) &
-					                     (value ^ state_machine->transition_array.comment))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
+				{
+					auto &transition_array = state_machine->transition_array;
+					const uint64_t characters[] = {transition_array.delimiter, transition_array.new_line,
+					                               transition_array.carriage_return, transition_array.comment};
+					iterator.pos.buffer_pos =
+					    NextStructuralCharacter(buffer_handle_ptr, iterator.pos.buffer_pos, to_pos, characters);
 				}
 				while (state_machine->transition_array
 				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
@@ -283,14 +326,11 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
+				{
+					auto &transition_array = state_machine->transition_array;
+					const uint64_t characters[] = {transition_array.new_line, transition_array.carriage_return};
+					iterator.pos.buffer_pos =
+					    NextStructuralCharacter(buffer_handle_ptr, iterator.pos.buffer_pos, to_pos, characters);
 				}
 				while (state_machine->transition_array
 				           .skip_comment[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
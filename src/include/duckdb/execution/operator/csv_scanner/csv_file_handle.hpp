@@ -30,6 +30,8 @@ public:
 	bool IsPipe();
 
 	void Reset();
+	//! Decompresses compressed files ahead of the reader in a background thread
+	void EnableReadAhead();
 
 	idx_t FileSize();
 
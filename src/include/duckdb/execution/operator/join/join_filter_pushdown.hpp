@@ -15,14 +15,22 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
+struct JoinFilterPushdownTarget {
+	//! The dynamic table filter set of the scan where to push the filter into
+	shared_ptr<DynamicTableFilterSet> dynamic_filters;
+	//! The column index of the scan to which the filter should be applied
+	idx_t column_index;
+};
+
 struct JoinFilterPushdownColumn {
 	//! The join condition from which this filter pushdown is generated
 	idx_t join_condition;
-	//! The probe column index to which this filter should be applied
-	ColumnBinding probe_column_index;
+	//! The scans (and their columns) to which this filter should be applied
+	vector<JoinFilterPushdownTarget> targets;
 };
 
 struct JoinFilterGlobalState {
@@ -40,8 +48,6 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
-	//! The dynamic table filter set where to push filters into
-	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
@@ -53,7 +59,13 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+	                 const PhysicalOperator &op) const;
+
+private:
+	//! Returns a filter that only accepts the values of the join condition in the hash table, or nullptr if the hash
+	//! table holds too many rows
+	unique_ptr<TableFilter> GetMembershipFilter(ClientContext &context, JoinHashTable &ht, idx_t join_condition) const;
 };
 
 } // namespace duckdb
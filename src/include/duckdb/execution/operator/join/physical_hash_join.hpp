@@ -52,6 +52,8 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! The key of the build side in the cardinality feedback (empty if cardinality feedback is disabled)
+	string cardinality_feedback_key;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
@@ -61,7 +61,9 @@ public:
 	bool destroyed;
 
 public:
-	explicit BlockingSample(int64_t seed) : old_base_reservoir_sample(seed), random(old_base_reservoir_sample.random) {
+	explicit BlockingSample(int64_t seed)
+	    : type(SampleType::BLOCKING_SAMPLE), destroyed(false), old_base_reservoir_sample(seed),
+	      random(old_base_reservoir_sample.random) {
 		base_reservoir_sample = nullptr;
 	}
 	virtual ~BlockingSample() {
@@ -124,6 +126,7 @@ public:
 	//! Fetches a chunk from the sample. Note that this method is destructive and should only be used after the
 	//! sample is completely built.
 	unique_ptr<DataChunk> GetChunk() override;
+	//! Finalizes the sample: no more rows can be added after this
 	void Finalize() override;
 	void Serialize(Serializer &serializer) const override;
 	static unique_ptr<BlockingSample> Deserialize(Deserializer &deserializer);
@@ -17,7 +17,8 @@ class DuckTableEntry;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(DuckTableEntry &table)
+	    : table(table), is_index_scan(false), is_create_index(false), vacuum_count(0) {
 	}
 
 	//! The table to scan
@@ -29,11 +30,14 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch in case of an index scan.
 	unsafe_vector<row_t> row_ids;
+	//! The vacuum count of the table when the row ids were collected. If the table was vacuumed since, the row ids
+	//! are stale and the table is scanned instead.
+	idx_t vacuum_count;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && row_ids == other.row_ids;
+		return &other.table == &table && row_ids == other.row_ids && vacuum_count == other.vacuum_count;
 	}
 };
 
@@ -42,6 +46,8 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! Fetches the columns of the rows with the row ids of its input, in the order of its input
+	static TableFunction GetRowIdFetchFunction();
 };
 
 } // namespace duckdb
@@ -91,6 +91,12 @@ struct ClientConfig {
 	//! Maximum bits allowed for using a perfect hash table (i.e. the perfect HT can hold up to 2^perfect_ht_threshold
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
+	//! The maximum number of build side rows of a hash join for which the join keys are pushed into the probe side as
+	//! a filter on their values (in addition to the min/max filter)
+	idx_t dynamic_or_filter_threshold = 50;
+	//! The maximum number of rows of a Top-N for which the other columns of the table are fetched by row id after the
+	//! Top-N, instead of being scanned for every row
+	idx_t late_materialization_max_rows = 50;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
 	//! The number of rows to accumulate before flushing during a partitioned write
@@ -230,13 +230,25 @@ private:
 	void CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement);
 
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
+	//! If generic_plan is set, the plan must work for any parameter values (i.e. it is not re-bound with the values)
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatement(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
 	                        optional_ptr<case_insensitive_map_t<BoundParameterData>> values = nullptr,
-	                        PreparedStatementMode mode = PreparedStatementMode::PREPARE_ONLY);
+	                        PreparedStatementMode mode = PreparedStatementMode::PREPARE_ONLY, bool generic_plan = false);
 	unique_ptr<PendingQueryResult> PendingStatementInternal(ClientContextLock &lock, const string &query,
 	                                                        unique_ptr<SQLStatement> statement,
 	                                                        const PendingQueryParameters &parameters);
+	//! Returns the result of the statement from the query result cache, or nullptr if it is not cached. Sets the key of
+	//! the statement if its result can be cached.
+	unique_ptr<PendingQueryResult> PendingCachedResultInternal(ClientContextLock &lock, const SQLStatement &statement,
+	                                                           const PendingQueryParameters &parameters, string &key);
+	//! Executes the statement with a plan from the plan cache. Returns nullptr if the statement cannot be cached.
+	unique_ptr<PendingQueryResult> PendingCachedStatementInternal(ClientContextLock &lock, const string &query,
+	                                                              const SQLStatement &statement,
+	                                                              const PendingQueryParameters &parameters);
+	unique_ptr<PendingQueryResult> PendingUncachedStatementInternal(ClientContextLock &lock, const string &query,
+	                                                                unique_ptr<SQLStatement> statement,
+	                                                                const PendingQueryParameters &parameters);
 	unique_ptr<QueryResult> RunStatementInternal(ClientContextLock &lock, const string &query,
 	                                             unique_ptr<SQLStatement> statement, bool allow_stream_result,
 	                                             bool verify = true);
@@ -274,7 +286,8 @@ private:
 
 	shared_ptr<PreparedStatementData>
 	CreatePreparedStatementInternal(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
-	                                optional_ptr<case_insensitive_map_t<BoundParameterData>> values);
+	                                optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
+	                                bool generic_plan = false);
 
 private:
 	//! Lock on using the ClientContext in parallel
@@ -157,6 +157,8 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress blocks that are offloaded to the temporary directory
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -174,6 +176,17 @@ struct DBConfigOptions {
 	bool enable_external_access = true;
 	//! Whether or not object cache is used
 	bool object_cache_enable = false;
+	//! The maximum memory used by the evictable entries of the object cache (e.g. Parquet metadata)
+	idx_t object_cache_memory_limit = DConstants::INVALID_INDEX;
+	//! The maximum number of query plans in the plan cache (0 disables the plan cache)
+	idx_t plan_cache_size = 0;
+	//! The maximum memory used by the query result cache (0 disables the query result cache)
+	idx_t query_result_cache_memory_limit = 0;
+	//! The number of rows sampled from each table at checkpoint for cardinality estimation (0 disables table samples)
+	idx_t table_sample_size = 0;
+	//! The factor by which the observed cardinality of a hash join build side has to be off from its estimate to be
+	//! remembered for planning (0 disables cardinality feedback)
+	double cardinality_feedback_threshold = 0;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
 	//! HTTP Proxy config as 'hostname:port'
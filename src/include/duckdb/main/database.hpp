@@ -25,6 +25,9 @@ class ConnectionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class PlanCache;
+class QueryResultCache;
+class CardinalityFeedback;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
@@ -54,6 +57,9 @@ public:
 	DUCKDB_API FileSystem &GetFileSystem();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API PlanCache &GetPlanCache();
+	DUCKDB_API QueryResultCache &GetQueryResultCache();
+	DUCKDB_API CardinalityFeedback &GetCardinalityFeedback();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const string &extension_name, ExtensionInstallInfo &install_info);
@@ -86,6 +92,9 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<PlanCache> plan_cache;
+	unique_ptr<QueryResultCache> query_result_cache;
+	unique_ptr<CardinalityFeedback> cardinality_feedback;
 	unique_ptr<ConnectionManager> connection_manager;
 	unordered_map<string, ExtensionInfo> loaded_extensions_info;
 	ValidChecker db_validity;
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/materialized_view.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+class AttachedDatabase;
+class Binder;
+class ClientContext;
+class ColumnDefinition;
+class LogicalDependencyList;
+class LogicalOperator;
+class SchemaCatalogEntry;
+class SelectNode;
+class SelectStatement;
+class TableCatalogEntry;
+
+//! A materialized view is a table that is kept up to date with the result of its query. The query reads a single
+//! table, which it can filter, project and aggregate with SUM, COUNT, MIN and MAX. The views are maintained when a
+//! transaction commits, with the rows that the transaction added to the table and the rows that it removed from it.
+//! Views with aggregates keep the number of rows of every group in a hidden column, so the groups that no longer
+//! have any rows can be removed. Only the groups that the changes touch are rewritten. Queries that are equal to the
+//! query of a view are answered by scanning the view.
+class MaterializedView {
+public:
+	//! Verifies that the bound query of a materialized view can be maintained, and returns the table that it reads
+	static TableCatalogEntry &VerifyQuery(LogicalOperator &plan);
+	//! Returns the dependency of a materialized view in the schema on the table that its query reads. This is used
+	//! when the view is loaded from a database file whose storage version does not store dependencies.
+	static LogicalDependencyList GetDependencies(const SelectStatement &query, SchemaCatalogEntry &schema);
+	//! Adds the number of rows of every group to the query of a materialized view with aggregates, which is stored in
+	//! the hidden count column of the view
+	static void AddCountColumn(SelectStatement &query);
+	//! Whether or not the column is the hidden count column of a materialized view
+	static bool IsCountColumn(const TableCatalogEntry &table, const ColumnDefinition &column);
+	//! Returns the materialized views over a table
+	static vector<reference<TableCatalogEntry>> GetViews(ClientContext &context, TableCatalogEntry &table);
+	//! Brings the materialized views up to date with the changes that the current transaction made to the database
+	static void MaintainViews(ClientContext &context, AttachedDatabase &db);
+	//! Replaces the query with a scan of a materialized view that has the same query (if there is one). Returns
+	//! whether or not the query was replaced.
+	static bool TryRewrite(Binder &binder, SelectNode &node);
+};
+
+} // namespace duckdb
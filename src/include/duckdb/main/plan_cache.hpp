@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/plan_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class PreparedStatementData;
+class SQLStatement;
+struct DataTableInfo;
+
+struct PlanCacheStats {
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+	idx_t entries;
+	idx_t max_entries;
+};
+
+//! A table that is read by a cached plan
+struct PlanCacheTable {
+	weak_ptr<DataTableInfo> info;
+	//! The commit version of the table when the plan was planned
+	transaction_t commit_version;
+};
+
+//! The plan cache holds the physical plans of SELECT statements, so repeated statements skip planning. It is shared
+//! by all connections of a database. Statements are keyed by their normalized text, in which the literals that are
+//! compared against in the WHERE clauses are replaced by parameters. Statements that only differ in these literals
+//! share a plan. The key also contains the connection-local settings, so connections only share plans when they would
+//! produce the same plan. A cached plan is used by a single query at a time: it is taken out of the cache while the
+//! query runs, and put back once the query has finished. Plans are invalidated through the catalog versions, in the
+//! same way as prepared statements, and through the commit versions of the tables that they read: plans depend on the
+//! rows of these tables through the table statistics (e.g. filters that are pruned) and index lookups.
+class PlanCache {
+public:
+	explicit PlanCache(idx_t max_entries);
+
+	static PlanCache &Get(ClientContext &context);
+
+	//! Whether the client can use the plan cache (e.g. clients with temporary objects cannot share plans)
+	static bool CanUse(ClientContext &context);
+	//! Replaces the literals of the WHERE comparisons of a SELECT statement with parameters. Returns the parameterized
+	//! statement and the literal values, or nullptr if the statement cannot be cached.
+	static unique_ptr<SQLStatement> Parameterize(const SQLStatement &statement,
+	                                             case_insensitive_map_t<BoundParameterData> &values);
+	//! The key of a parameterized statement for the client
+	static string GetKey(ClientContext &context, const SQLStatement &statement);
+	//! Whether or not a prepared (parameterized) statement can be cached
+	static bool IsCacheable(const PreparedStatementData &prepared);
+	//! Returns the tables that a logical plan reads. This is done before the plan is optimized, as the optimizer can
+	//! remove scans based on the statistics of the tables.
+	static vector<weak_ptr<DataTableInfo>> GetReadTables(LogicalOperator &plan);
+	//! Collects the commit versions of the tables that a plan reads. Returns false if the transaction of the client
+	//! does not see the latest committed rows of these tables, i.e. the plan cannot be shared.
+	static bool GetTableVersions(ClientContext &context, const PreparedStatementData &prepared,
+	                             vector<PlanCacheTable> &tables);
+	//! Whether or not the rows of the tables that a cached plan reads are unchanged for the client
+	static bool IsValid(ClientContext &context, const vector<PlanCacheTable> &tables);
+	//! Casts the literal values to the types of the parameters of the plan. Returns false if the plan would not give
+	//! the same result as planning the statement with the literals.
+	static bool BindValues(const PreparedStatementData &prepared, case_insensitive_map_t<BoundParameterData> &values);
+
+	bool Enabled();
+	//! Takes the plan of the key and the tables that it reads out of the cache. Sets cacheable to false if the
+	//! statement was found to be uncacheable before.
+	shared_ptr<PreparedStatementData> Take(const string &key, bool &cacheable, vector<PlanCacheTable> &tables);
+	//! Puts the plan of the key (back) in the cache, evicting the least recently used plans if the cache is full
+	void Put(const string &key, shared_ptr<PreparedStatementData> prepared, vector<PlanCacheTable> tables);
+	//! Remembers that the statement of the key cannot be cached
+	void MarkUncacheable(const string &key);
+
+	void Clear();
+	void SetMaxEntries(idx_t max_entries);
+	PlanCacheStats GetStats();
+
+private:
+	struct CachedPlan {
+		//! The plan, or nullptr if the statement cannot be cached
+		shared_ptr<PreparedStatementData> prepared;
+		vector<PlanCacheTable> tables;
+		list<string>::iterator lru_position;
+	};
+
+	void Insert(const string &key, shared_ptr<PreparedStatementData> prepared, vector<PlanCacheTable> tables);
+	void EvictToLimit();
+
+private:
+	mutex lock;
+	//! The cached plans by key
+	unordered_map<string, CachedPlan> plans;
+	//! The keys of the cached plans, from most to least recently used
+	list<string> lru_list;
+	idx_t max_entries;
+
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+};
+
+} // namespace duckdb
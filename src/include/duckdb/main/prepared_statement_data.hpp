@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -45,6 +46,8 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The storage of the tables that are read by the statement
+	vector<weak_ptr<DataTableInfo>> read_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/statement_type.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/winapi.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class PreparedStatementData;
+struct DataTableInfo;
+
+struct QueryResultCacheStats {
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+	idx_t entries;
+	idx_t memory_usage;
+	idx_t memory_limit;
+};
+
+//! The query result cache holds the results of SELECT statements, so repeated statements return without running
+//! their plan. It is shared by all connections of a database. Results are keyed in the same way as the plans of the
+//! plan cache (the statement text, the search path and the connection-local settings), and are valid as long as the
+//! catalogs that the statement read from are unchanged, and no transaction has changed the rows of the tables that it
+//! scanned. A result is only cached or returned when the transaction sees the latest committed rows of these tables.
+//! Statements that call volatile functions or scan table functions (e.g. files) are never cached. The results are
+//! stored in buffer-managed collections, and the least recently used results are evicted to stay within the memory
+//! limit.
+class QueryResultCache {
+public:
+	explicit QueryResultCache(idx_t memory_limit);
+
+	static QueryResultCache &Get(ClientContext &context);
+
+	//! Whether the client can use the result cache
+	static bool CanUse(ClientContext &context);
+	//! Whether or not the result of a prepared statement can be cached
+	static bool IsCacheable(const PreparedStatementData &prepared);
+
+	bool Enabled();
+	//! Returns the cached result of the key if it is still valid for the client (or nullptr)
+	shared_ptr<ColumnDataCollection> Lookup(ClientContext &context, const string &key, vector<string> &names);
+	//! Caches the result of a prepared statement, if it fits in the memory limit and reflects the committed rows
+	void Put(ClientContext &context, const string &key, const PreparedStatementData &prepared,
+	         ColumnDataCollection &result);
+
+	void Clear();
+	void SetMemoryLimit(idx_t memory_limit);
+	QueryResultCacheStats GetStats();
+
+private:
+	struct ScannedTable {
+		weak_ptr<DataTableInfo> info;
+		//! The commit version of the table when the result was computed
+		transaction_t commit_version;
+	};
+	struct CachedResult {
+		shared_ptr<ColumnDataCollection> collection;
+		vector<string> names;
+		//! The catalogs that the statement read from
+		unordered_map<string, StatementProperties::CatalogIdentity> read_databases;
+		vector<ScannedTable> tables;
+		idx_t memory_usage;
+		list<string>::iterator lru_position;
+	};
+
+	//! Whether or not the cached result still holds for the client
+	static bool IsValid(ClientContext &context, const CachedResult &entry);
+	void Erase(unordered_map<string, CachedResult>::iterator entry);
+	void EvictToLimit();
+
+private:
+	mutex lock;
+	//! The cached results by key
+	unordered_map<string, CachedResult> results;
+	//! The keys of the cached results, from most to least recently used
+	list<string> lru_list;
+	idx_t memory_limit;
+	idx_t memory_usage = 0;
+
+	idx_t hits = 0;
+	idx_t misses = 0;
+	idx_t evictions = 0;
+};
+
+} // namespace duckdb
@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/aggregate_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class BoundAggregateExpression;
+class Optimizer;
+
+//! The AggregatePushdown optimizer pre-aggregates one side of an inner join below a GROUP BY (eager aggregation),
+//! e.g. it aggregates a fact table by its join keys before joining it with its dimension tables. This is only done
+//! for decomposable aggregates (SUM, COUNT, MIN, MAX and AVG), and when the aggregate is estimated to reduce the
+//! number of rows significantly.
+class AggregatePushdown {
+public:
+	explicit AggregatePushdown(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+	//! Pre-aggregate a side of a join only when this reduces its estimated number of rows by at least this factor
+	static constexpr const idx_t MINIMUM_REDUCTION = 10;
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	//! Tries to push the aggregate below the join, returns whether or not the plan was rewritten
+	bool TryPushdown(unique_ptr<LogicalOperator> &op);
+	//! Estimates the number of groups of the columns, returns false if the estimate is unavailable
+	bool EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &columns, idx_t &result);
+	//! Binds the aggregate function with the given name on the input
+	unique_ptr<BoundAggregateExpression> BindAggregate(const string &name, unique_ptr<Expression> input);
+
+private:
+	Optimizer &optimizer;
+	//! The bindings of the rewritten aggregates, which are replaced in the plan after the rewrite
+	vector<ReplacementBinding> replacement_bindings;
+};
+
+} // namespace duckdb
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/common_subplan_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class Optimizer;
+
+//! The CommonSubplanOptimizer finds subplans that occur multiple times in a query (e.g. the same join or aggregate in
+//! both branches of a UNION, or on both sides of a self-join). Each of these subplans is computed once in a
+//! materialized CTE, and all of its occurrences are replaced by a reference to the CTE.
+class CommonSubplanOptimizer {
+public:
+	explicit CommonSubplanOptimizer(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! A subplan that can be computed in a materialized CTE
+	struct SubplanInfo {
+		SubplanInfo(unique_ptr<LogicalOperator> &op, string signature, idx_t operator_count);
+
+		//! The subplan (in the children of its parent)
+		reference<unique_ptr<LogicalOperator>> op;
+		//! The structure of the subplan, without its table indexes. Equal subplans have the same signature.
+		string signature;
+		//! The number of operators in the subplan
+		idx_t operator_count;
+	};
+
+private:
+	//! Collects the subplans that are worth sharing. Returns whether or not the plan of op could be shared.
+	bool CollectSubplans(unique_ptr<LogicalOperator> &op, string &signature, idx_t &operator_count,
+	                     bool &has_join_or_aggregate);
+	//! Replaces the occurrences of a subplan with references to a materialized CTE that is placed on top of root
+	void MaterializeSubplan(unique_ptr<LogicalOperator> &root, const vector<idx_t> &occurrences);
+
+	//! Whether or not the operator (without its children) can be part of a shared subplan
+	static bool CanShareOperator(LogicalOperator &op);
+	//! Whether or not two subplans compute the same result. The table indexes of left are mapped to those of right.
+	static bool SubplansAreEqual(LogicalOperator &left, LogicalOperator &right, unordered_map<idx_t, idx_t> &table_map);
+
+private:
+	//! The optimizer
+	Optimizer &optimizer;
+	//! The subplans that are worth sharing
+	vector<SubplanInfo> subplans;
+};
+
+} // namespace duckdb
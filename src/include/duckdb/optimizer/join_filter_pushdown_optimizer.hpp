@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class Optimizer;
+class LogicalGet;
 
 //! The JoinFilterPushdownOptimizer links comparison joins to data sources to enable dynamic execution-time filter
 //! pushdown
@@ -24,6 +25,11 @@ public:
 
 private:
 	void GenerateJoinFilters(LogicalComparisonJoin &join);
+	//! Finds the columns of the scans below the operator that a join filter on the binding can be pushed into. The
+	//! filter follows the column through the equality conditions of inner and semi joins, so it can prune scans on
+	//! both sides of these joins.
+	static void GetPushdownTargets(LogicalOperator &op, const ColumnBinding &binding,
+	                               vector<reference<LogicalGet>> &gets, vector<idx_t> &column_indexes);
 
 private:
 	Optimizer &optimizer;
@@ -15,6 +15,7 @@
 namespace duckdb {
 
 class FilterInfo;
+class CardinalityFeedback;
 
 struct DenomInfo {
 	DenomInfo(JoinRelationSet &numerator_relations, double filter_strength, double denominator)
@@ -96,6 +97,10 @@ private:
 	unordered_map<string, CardinalityHelper> relation_set_2_cardinality;
 	JoinRelationSetManager set_manager;
 	vector<RelationStats> relation_stats;
+	//! the observed cardinalities of previous queries, if cardinality feedback is enabled
+	optional_ptr<CardinalityFeedback> cardinality_feedback;
+	//! relation id -> the key of the relation in the cardinality feedback
+	unordered_map<idx_t, string> relation_feedback_keys;
 
 public:
 	void RemoveEmptyTotalDomains();
@@ -103,6 +108,7 @@ public:
 	void InitEquivalentRelations(const vector<unique_ptr<FilterInfo>> &filter_infos);
 
 	void InitCardinalityEstimatorProps(optional_ptr<JoinRelationSet> set, RelationStats &stats);
+	void SetCardinalityFeedback(CardinalityFeedback &feedback);
 
 	//! cost model needs estimated cardinalities to the fraction since the formula captures
 	//! distinct count selectivities and multiplicities. Hence the template
@@ -114,6 +120,8 @@ public:
 	void PrintRelationToTdomInfo();
 
 private:
+	//! Gets the cardinality of the set of relations that was observed by a previous query, if any
+	bool TryGetObservedCardinality(JoinRelationSet &set, idx_t &result);
 	double GetNumerator(JoinRelationSet &set);
 	DenomInfo GetDenominator(JoinRelationSet &set);
 
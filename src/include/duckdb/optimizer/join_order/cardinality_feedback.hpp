@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+
+//! The cardinality feedback holds the cardinalities that were observed while executing a query, for the relations of
+//! which the estimated cardinality was off by more than the cardinality_feedback_threshold. The hash joins record the
+//! number of rows of their build side, and the join order optimizer uses the observed cardinality instead of its
+//! estimate the next time the same relations are joined. The feedback is shared by all connections of a database.
+class CardinalityFeedback {
+public:
+	//! The maximum number of observed cardinalities that are kept
+	static constexpr idx_t MAX_ENTRIES = 4096;
+
+	CardinalityFeedback();
+
+	static CardinalityFeedback &Get(ClientContext &context);
+	//! Whether cardinalities are recorded and used
+	static bool Enabled(ClientContext &context);
+
+	//! The key of a single relation of the join order optimizer
+	static string GetRelationKey(ClientContext &context, LogicalOperator &op);
+	//! The key of the result of joining the relations with the given keys
+	static string GetKey(vector<string> relation_keys);
+	//! The key of the result of an operator, which is the join of the relations underneath it
+	static string GetKey(ClientContext &context, LogicalOperator &op);
+
+	//! Records the observed cardinality of the key if it is off by more than the threshold from the estimate
+	void Record(ClientContext &context, const string &key, idx_t estimated_cardinality, idx_t cardinality);
+	//! Gets the observed cardinality of the key, if any
+	bool TryGetCardinality(const string &key, idx_t &result);
+
+	//! Incremented whenever a cardinality is recorded
+	idx_t GetVersion() const {
+		return version;
+	}
+	void Clear();
+
+private:
+	static void CollectRelationKeys(ClientContext &context, LogicalOperator &op, vector<string> &relation_keys);
+
+private:
+	mutex lock;
+	unordered_map<string, idx_t> cardinalities;
+	atomic<idx_t> version;
+};
+
+} // namespace duckdb
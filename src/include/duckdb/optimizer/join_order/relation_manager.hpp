@@ -69,6 +69,10 @@ public:
 
 	void PrintRelationStats();
 
+private:
+	//! Replaces the estimated cardinality of the relation with the observed cardinality, if there is one
+	void ApplyCardinalityFeedback(LogicalOperator &op, RelationStats &stats);
+
 private:
 	ClientContext &context;
 	//! Set of all relations considered in the join optimizer
@@ -35,6 +35,8 @@ struct RelationStats {
 	// for debug, column names and tables
 	vector<string> column_names;
 	string table_name;
+	//! the key of the relation in the cardinality feedback, if cardinality feedback is enabled
+	string feedback_key;
 
 	RelationStats() : cardinality(1), filter_strength(1), stats_initialized(false) {
 	}
@@ -51,6 +53,15 @@ public:
 	//	                                  BaseStatistics &base_stats);
 	//! Extract Statistics from a LogicalGet.
 	static RelationStats ExtractGetStats(LogicalGet &get, ClientContext &context);
+	//! Estimates the cardinality of a table scan after its table filters and the given filter operators by evaluating
+	//! the filters on the sample of the table. Returns an invalid index if the table has no sample, or if the filters
+	//! cannot be evaluated on it.
+	static optional_idx EstimateCardinalityWithSample(LogicalGet &get, ClientContext &context,
+	                                                  const vector<reference<LogicalOperator>> &filters);
+	//! Estimates the cardinality of a table scan after its table filters with the value distributions that ANALYZE
+	//! computed for the filtered columns. Returns an invalid index if none of the filtered columns has a distribution.
+	static optional_idx EstimateCardinalityWithDistributions(LogicalGet &get, ClientContext &context,
+	                                                         idx_t base_table_cardinality);
 	static RelationStats ExtractDelimGetStats(LogicalDelimGet &delim_get, ClientContext &context);
 	//! Create the statistics for a projection using the statistics of the operator that sits underneath the
 	//! projection. Then also create statistics for any extra columns the projection creates.
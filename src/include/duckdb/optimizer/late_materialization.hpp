@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+class LogicalGet;
+class LogicalTopN;
+class Optimizer;
+
+//! The LateMaterialization optimizer rewrites Top-N queries over wide tables, so that only the columns that are
+//! needed to compute the Top-N (and the row ids) are scanned. The other columns are fetched by row id for the rows
+//! that make it into the result.
+class LateMaterialization {
+public:
+	explicit LateMaterialization(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Tries to rewrite the Top-N, returns whether or not it was rewritten
+	bool TryLateMaterialization(unique_ptr<LogicalOperator> &op);
+	//! Maps the columns of the scan that the expression references to the columns of the narrow scan. Returns false if
+	//! the expression references anything else than the columns of the scan.
+	static bool CollectColumns(Expression &expr, idx_t table_index, const vector<column_t> &column_ids,
+	                           idx_t narrow_table_index, vector<column_t> &narrow_column_ids,
+	                           column_binding_map_t<ColumnBinding> &binding_map);
+	//! Rewrites the column references to the scan in the expression to the narrow scan
+	static void ReplaceBindings(Expression &expr, const column_binding_map_t<ColumnBinding> &binding_map);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
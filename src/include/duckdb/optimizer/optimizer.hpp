@@ -33,6 +33,8 @@ public:
 	ClientContext &context;
 	Binder &binder;
 	ExpressionRewriter rewriter;
+	//! Whether the plan must work for any parameter values, i.e. parameters cannot be replaced by their values
+	bool generic_plan = false;
 
 private:
 	void RunBuiltInOptimizers();
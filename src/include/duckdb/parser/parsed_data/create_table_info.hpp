@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The query of a materialized view (if any), which the table is kept up to date with
+	unique_ptr<SelectStatement> view_query;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
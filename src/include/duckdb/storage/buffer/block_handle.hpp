@@ -116,6 +116,13 @@ public:
 		return state == BlockState::BLOCK_UNLOADED;
 	}
 
+	//! Record a pin of the block while it is already loaded; must be called while holding the block lock
+	inline void IncrementAccessFrequency() {
+		if (access_frequency < MAXIMUM_ACCESS_FREQUENCY) {
+			access_frequency++;
+		}
+	}
+
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
 	static BufferHandle LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
@@ -140,6 +147,10 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The number of times the block was pinned while loaded (saturating), used by frequency-aware eviction queues
+	uint8_t access_frequency;
+	//! The maximum access frequency we track, i.e., the maximum number of extra passes through the eviction queue
+	static constexpr uint8_t MAXIMUM_ACCESS_FREQUENCY = 3;
 	//! When to destroy the data buffer
 	DestroyBufferUpon destroy_buffer_upon;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
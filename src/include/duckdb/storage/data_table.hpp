@@ -37,6 +37,7 @@ class StorageManager;
 class TableCatalogEntry;
 class TableIOManager;
 class Transaction;
+class ValueDistribution;
 class WriteAheadLog;
 class TableDataWriter;
 class ConflictManager;
@@ -93,7 +94,7 @@ public:
 	void Scan(DuckTransaction &transaction, DataChunk &result, TableScanState &state);
 
 	//! Fetch data from the specific row identifiers from the base table
-	void Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
+	void Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
 	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state);
 
 	//! Initializes an append to transaction-local storage
@@ -180,8 +181,15 @@ public:
 
 	//! Get statistics of a physical column within the table
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
+	//! Copies the rows of the sample collected at the last checkpoint, or returns nullptr if there is no sample. The
+	//! sample contains the physical columns of the table.
+	unique_ptr<DataChunk> GetTableSample();
+	//! Copies the value distribution of a physical column computed by ANALYZE, or returns nullptr if there is none
+	unique_ptr<ValueDistribution> GetValueDistribution(column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Sets the value distribution of a physical column within the table
+	void SetValueDistribution(column_t column_id, unique_ptr<ValueDistribution> distribution);
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -11,6 +11,9 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
@@ -24,6 +27,11 @@ public:
 	}
 
 	virtual string GetObjectType() = 0;
+
+	//! The estimated memory used by the entry - entries without an estimate are never evicted from the cache
+	virtual optional_idx GetEstimatedCacheMemory() const {
+		return optional_idx();
+	}
 };
 
 class ObjectCache {
@@ -34,7 +42,8 @@ public:
 		if (entry == cache.end()) {
 			return nullptr;
 		}
-		return entry->second;
+		Touch(entry->second);
+		return entry->second.object;
 	}
 
 	template <class T>
@@ -53,32 +62,107 @@ public:
 		auto entry = cache.find(key);
 		if (entry == cache.end()) {
 			auto value = make_shared_ptr<T>(args...);
-			cache[key] = value;
+			Insert(key, value);
 			return value;
 		}
-		auto object = entry->second;
+		Touch(entry->second);
+		auto object = entry->second.object;
 		if (!object || object->GetObjectType() != T::ObjectType()) {
 			return nullptr;
 		}
 		return shared_ptr_cast<ObjectCacheEntry, T>(object);
 	}
 
+	//! Inserts the value into the cache, replacing any existing entry for the key
 	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
 		lock_guard<mutex> glock(lock);
-		cache.insert(make_pair(std::move(key), std::move(value)));
+		Erase(key);
+		Insert(key, std::move(value));
 	}
 
 	void Delete(const string &key) {
 		lock_guard<mutex> glock(lock);
-		cache.erase(key);
+		Erase(key);
+	}
+
+	//! Sets the maximum memory used by the evictable entries, evicting the least recently used entries if required
+	void SetMaxMemory(idx_t max_memory_p) {
+		lock_guard<mutex> glock(lock);
+		max_memory = max_memory_p;
+		EvictToLimit();
+	}
+
+	//! The estimated memory currently used by the evictable entries
+	idx_t GetCurrentMemory() {
+		lock_guard<mutex> glock(lock);
+		return current_memory;
 	}
 
 	DUCKDB_API static ObjectCache &GetObjectCache(ClientContext &context);
 	DUCKDB_API static bool ObjectCacheEnabled(ClientContext &context);
 
+private:
+	struct CacheEntry {
+		shared_ptr<ObjectCacheEntry> object;
+		//! Whether or not the entry can be evicted from the cache
+		bool evictable = false;
+		//! The estimated memory of the entry (only valid for evictable entries)
+		idx_t memory = 0;
+		//! The position in the LRU list (only valid for evictable entries)
+		list<string>::iterator lru_position;
+	};
+
+	void Insert(const string &key, shared_ptr<ObjectCacheEntry> value) {
+		CacheEntry entry;
+		auto estimated_memory = value ? value->GetEstimatedCacheMemory() : optional_idx();
+		entry.object = std::move(value);
+		if (estimated_memory.IsValid()) {
+			entry.evictable = true;
+			entry.memory = estimated_memory.GetIndex();
+			lru_list.push_front(key);
+			entry.lru_position = lru_list.begin();
+			current_memory += entry.memory;
+		}
+		cache[key] = std::move(entry);
+		EvictToLimit();
+	}
+
+	void Erase(const string &key) {
+		auto entry = cache.find(key);
+		if (entry == cache.end()) {
+			return;
+		}
+		if (entry->second.evictable) {
+			lru_list.erase(entry->second.lru_position);
+			current_memory -= entry->second.memory;
+		}
+		cache.erase(entry);
+	}
+
+	//! Marks the entry as most recently used
+	void Touch(CacheEntry &entry) {
+		if (entry.evictable) {
+			lru_list.splice(lru_list.begin(), lru_list, entry.lru_position);
+		}
+	}
+
+	void EvictToLimit() {
+		while (current_memory > max_memory && !lru_list.empty()) {
+			// copy the key: erasing the entry removes it from the LRU list
+			auto key = lru_list.back();
+			Erase(key);
+		}
+	}
+
 private:
 	//! Object Cache
-	unordered_map<string, shared_ptr<ObjectCacheEntry>> cache;
+	unordered_map<string, CacheEntry> cache;
+	//! The keys of the evictable entries, from most to least recently used
+	list<string> lru_list;
+	//! The estimated memory used by the evictable entries
+	idx_t current_memory = 0;
+	//! The maximum memory used by the evictable entries
+	idx_t max_memory = NumericLimits<idx_t>::Maximum();
 	mutex lock;
 };
 
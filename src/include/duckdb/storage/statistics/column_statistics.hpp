@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/value_distribution.hpp"
 
 namespace duckdb {
 class Serializer;
@@ -32,6 +33,10 @@ public:
 	DistinctStatistics &DistinctStats();
 	void SetDistinct(unique_ptr<DistinctStatistics> distinct_stats);
 
+	bool HasValueDistribution();
+	ValueDistribution &GetValueDistribution();
+	void SetValueDistribution(unique_ptr<ValueDistribution> distribution);
+
 	shared_ptr<ColumnStatistics> Copy() const;
 
 	void Serialize(Serializer &serializer) const;
@@ -41,6 +46,8 @@ private:
 	BaseStatistics stats;
 	//! The approximate count distinct stats of the column
 	unique_ptr<DistinctStatistics> distinct_stats;
+	//! The distribution of the values of the column, computed by ANALYZE
+	unique_ptr<ValueDistribution> distribution;
 };
 
 } // namespace duckdb
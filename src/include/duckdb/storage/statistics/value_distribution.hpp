@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/value_distribution.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Vector;
+class Serializer;
+class Deserializer;
+
+//! The distribution of the values of a column, computed by ANALYZE from a sample of the column. The most common values
+//! are kept together with their frequency, and the other values are summarized by an equi-depth histogram: each bucket
+//! between two consecutive bounds holds the same number of values.
+class ValueDistribution {
+public:
+	//! The number of rows that are sampled to compute the distribution
+	static constexpr idx_t SAMPLE_SIZE = 30000;
+	static constexpr idx_t MAX_MOST_COMMON_VALUES = 32;
+	static constexpr idx_t MAX_HISTOGRAM_BUCKETS = 64;
+
+	ValueDistribution();
+
+	//! The fraction of the rows that is NULL
+	double null_fraction;
+	//! The most common values, from most to least common
+	vector<Value> most_common_values;
+	//! The fraction of the rows that holds each of the most common values
+	vector<double> most_common_frequencies;
+	//! The fraction of the rows that holds another (non-NULL) value
+	double histogram_fraction;
+	//! The bounds of the histogram of the other values
+	vector<Value> histogram_bounds;
+	//! The number of distinct other values in the sample
+	idx_t histogram_distinct_count;
+
+public:
+	//! Computes the distribution of the sampled values
+	static unique_ptr<ValueDistribution> Create(Vector &sample, idx_t count);
+	static bool TypeIsSupported(const LogicalType &type);
+
+	//! The fraction of the rows that equals the value, given the distinct count of the column
+	double EqualSelectivity(const Value &value, idx_t distinct_count) const;
+	//! The fraction of the rows that lies in the range between the bounds (NULL bounds are unbounded)
+	double RangeSelectivity(const Value &lower, bool lower_inclusive, const Value &upper, bool upper_inclusive) const;
+
+	unique_ptr<ValueDistribution> Copy() const;
+	string ToString() const;
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<ValueDistribution> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The estimated fraction of the histogram values that are smaller than (or equal to) the value
+	double HistogramFractionBelow(const Value &value) const;
+};
+
+} // namespace duckdb
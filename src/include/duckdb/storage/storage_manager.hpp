@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -84,6 +85,11 @@ public:
 	optional_ptr<WriteAheadLog> GetWAL();
 	//! Deletes the WAL file, and resets the unique pointer.
 	void ResetWAL();
+	//! Marks that table statistics changed without writing to the WAL (e.g., by ANALYZE), so that the next checkpoint
+	//! writes them even if the WAL is empty
+	void SetStatisticsChanged() {
+		statistics_changed = true;
+	}
 
 	//! Returns the database file path
 	string GetDBPath() const {
@@ -120,6 +126,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Whether or not table statistics changed since the last checkpoint
+	atomic<bool> statistics_changed {false};
 
 public:
 	template <class TARGET>
@@ -49,6 +49,21 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! The commit id of the last transaction that changed the rows of the table
+	transaction_t GetCommitVersion() const {
+		return commit_version;
+	}
+	void SetCommitVersion(transaction_t version) {
+		commit_version = version;
+	}
+	//! The number of checkpoints that moved rows of the table to other row ids by vacuuming deletes
+	idx_t GetVacuumCount() const {
+		return vacuum_count;
+	}
+	void IncrementVacuumCount() {
+		vacuum_count++;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +81,10 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that changed the rows of the table (0 if none did since it was loaded)
+	atomic<transaction_t> commit_version;
+	//! The number of checkpoints that moved rows of the table to other row ids by vacuuming deletes
+	atomic<idx_t> vacuum_count;
 };
 
 } // namespace duckdb
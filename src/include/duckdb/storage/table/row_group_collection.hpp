@@ -99,6 +99,8 @@ public:
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
+	//! Whether or not vacuuming deletes is compatible with the indexes of the table
+	bool CanVacuumIndexes();
 	void ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
 
 	void CommitDropColumn(idx_t index);
@@ -117,6 +119,12 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	void SetValueDistribution(column_t column_id, unique_ptr<ValueDistribution> distribution);
+	//! Collects a reservoir sample of the committed rows
+	unique_ptr<BlockingSample> SampleRows(idx_t sample_size);
+	TableStatistics &GetTableStatistics() {
+		return stats;
+	}
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
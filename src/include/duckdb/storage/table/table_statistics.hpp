@@ -48,6 +48,17 @@ public:
 	//! Get a reference to the stats - this requires us to hold the lock.
 	//! The reference can only be safely accessed while the lock is held
 	ColumnStatistics &GetStats(TableStatisticsLock &lock, idx_t i);
+	//! Copies the value distribution of the column, or returns nullptr if the column has no value distribution
+	unique_ptr<ValueDistribution> CopyValueDistribution(idx_t i);
+
+	//! Sets the sample of the rows of the table
+	void SetTableSample(unique_ptr<BlockingSample> sample);
+	//! Copies the table sample into the other statistics
+	void CopyTableSample(TableStatistics &other);
+	//! Whether or not the table has a sample of (at most) the given number of rows
+	bool HasTableSample(idx_t sample_size);
+	//! Copies the rows of the table sample, or returns nullptr if the table has no sample
+	unique_ptr<DataChunk> GetTableSample();
 
 	bool Empty();
 
@@ -56,13 +67,16 @@ public:
 	void Serialize(Serializer &serializer) const;
 	void Deserialize(Deserializer &deserializer, ColumnList &columns);
 
+private:
+	unique_ptr<DataChunk> GetTableSample(TableStatisticsLock &lock);
+	unique_ptr<BlockingSample> CopyTableSample(TableStatisticsLock &lock);
+
 private:
 	//! The statistics lock
 	shared_ptr<mutex> stats_lock;
 	//! Column statistics
 	vector<shared_ptr<ColumnStatistics>> column_stats;
-	//! The table sample
-	//! Sample for table
+	//! A reservoir sample of the rows of the table, collected at checkpoint
 	unique_ptr<BlockingSample> table_sample;
 };
 
@@ -27,7 +27,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +48,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of the blocks on disk, used to report size changes to the manager
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -75,7 +77,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -88,8 +90,14 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a buffer to the given index. If "compressed_buffer" is set, its contents are written instead of the
+	//! buffer, and must fit in the slot size of this file
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of a block slot in this file
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -104,6 +112,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of each block slot in this file. Slots smaller than the block allocation size hold compressed blocks
+	const idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -136,6 +146,12 @@ public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
 
+	//! Compressed blocks are stored in files with slots of (n / SLOT_SIZE_CLASSES) * block allocation size, i.e., in
+	//! the smallest slot size that fits them. Uncompressed blocks use slots of the full block allocation size.
+	static constexpr idx_t SLOT_SIZE_CLASSES = 8;
+	//! After a block failed to compress into a smaller slot, we skip compression for up to this many blocks
+	static constexpr idx_t MAX_COMPRESSION_BACKOFF = 64;
+
 public:
 	struct TemporaryManagerLock {
 	public:
@@ -159,6 +175,11 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Tries to compress the buffer into "compressed_buffer", returns the slot size to write the buffer to
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
+	//! Whether we should try to compress the next buffer, based on how well previous buffers compressed
+	bool ShouldCompress();
+	void UpdateCompressionBackoff(bool compressed);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -180,6 +201,10 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! The number of blocks we skip compressing, because recent blocks did not compress well
+	atomic<idx_t> compression_skip_count;
+	//! The current number of blocks to skip after a block fails to compress (doubles on every consecutive failure)
+	atomic<idx_t> compression_backoff;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class RowGroupCollection;
+struct DataTableInfo;
 class RowVersionManager;
 class DuckTransactionManager;
 class StorageLockKey;
@@ -79,6 +80,22 @@ public:
 
 	void UpdateCollection(shared_ptr<RowGroupCollection> &collection);
 
+	//! Registers that rows of the table were deleted or updated by this transaction
+	void ModifyTable(DataTable &table);
+	//! Returns whether or not rows of the table were deleted or updated by this transaction
+	bool IsModifiedTable(DataTable &table);
+	//! Returns the tables in which rows were deleted or updated by this transaction
+	vector<reference<DataTable>> GetModifiedTables();
+	//! Returns the (sorted) row ids of the rows of the table that were deleted or updated by this transaction
+	vector<row_t> GetModifiedRows(DataTable &table);
+	//! Registers that the transaction can only commit if no other transaction committed changes to the table after
+	//! this transaction started
+	void RequireUnchangedTable(DataTable &table);
+
+private:
+	//! Collects the tables that are changed by the transaction, before their local storage is committed
+	void CollectChangedTables();
+
 private:
 	DuckTransactionManager &transaction_manager;
 	//! The undo buffer is used to store old versions of rows that are updated
@@ -94,6 +111,14 @@ private:
 	reference_map_t<SequenceCatalogEntry, reference<SequenceValue>> sequence_usage;
 	//! Collections that are updated by this transaction
 	reference_map_t<RowGroupCollection, shared_ptr<RowGroupCollection>> updated_collections;
+	//! Lock for accessing modified_tables
+	mutex modified_tables_lock;
+	//! The tables in which rows were deleted or updated by this transaction
+	reference_set_t<DataTable> modified_tables;
+	//! The tables that must not have been changed by other transactions when this transaction commits
+	vector<shared_ptr<DataTableInfo>> unchanged_tables;
+	//! The tables that are changed by the transaction, of which the commit version is set when it commits
+	vector<reference<DataTable>> changed_tables;
 };
 
 } // namespace duckdb
@@ -82,6 +82,7 @@ public:
 	LocalTableStorage &GetOrCreateStorage(ClientContext &context, DataTable &table);
 	idx_t EstimatedSize();
 	bool IsEmpty();
+	vector<reference<DataTable>> GetTables();
 	void InsertEntry(DataTable &table, shared_ptr<LocalTableStorage> entry);
 
 private:
@@ -146,6 +147,8 @@ public:
 
 	void DropTable(DataTable &table);
 	bool Find(DataTable &table);
+	//! Returns the tables that have transaction-local storage
+	vector<reference<DataTable>> GetTables();
 
 	idx_t AddedRows(DataTable &table);
 
@@ -13,6 +13,7 @@
 #include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
+class DataTable;
 class StorageCommitState;
 class WriteAheadLog;
 
@@ -44,6 +45,8 @@ public:
 
 	bool ChangesMade();
 	UndoBufferProperties GetProperties();
+	//! Returns the (sorted) row ids of the rows of the table that were deleted or updated
+	vector<row_t> GetModifiedRows(DataTable &table);
 
 	//! Cleanup the undo buffer
 	void Cleanup(transaction_t lowest_active_transaction);
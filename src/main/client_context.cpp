@@ -10,6 +10,7 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -20,10 +21,13 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/parameter_expression.hpp"
@@ -49,12 +53,22 @@ struct ActiveQueryContext {
 public:
 	//! The query that is currently being executed
 	string query;
+	//! The cached result that is returned by the query (if any), which is scanned by its plan
+	shared_ptr<ColumnDataCollection> cached_result;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The plan cache key of the prepared statement, if it is returned to the plan cache after the query
+	string plan_cache_key;
+	//! The tables that the plan of the plan cache reads
+	vector<PlanCacheTable> plan_cache_tables;
+	//! The query result cache key of the statement, if its result is put in the query result cache
+	string result_cache_key;
+	//! The version of the cardinality feedback when the query started
+	idx_t cardinality_feedback_version = 0;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -211,7 +225,19 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	active_query->progress_bar.reset();
 
 	D_ASSERT(active_query.get());
+	shared_ptr<PreparedStatementData> cached_plan;
+	string plan_cache_key = std::move(active_query->plan_cache_key);
+	auto plan_cache_tables = std::move(active_query->plan_cache_tables);
+	if (!plan_cache_key.empty()) {
+		cached_plan = std::move(active_query->prepared);
+	}
+	// if the query observed misestimated cardinalities, the statement is planned again with the observed cardinalities
+	bool replan = CardinalityFeedback::Get(*this).GetVersion() != active_query->cardinality_feedback_version;
 	active_query.reset();
+	if (success && cached_plan && !replan) {
+		// the executor is gone: the plan can be used by the next query
+		PlanCache::Get(*this).Put(plan_cache_key, std::move(cached_plan), std::move(plan_cache_tables));
+	}
 	query_progress.Initialize();
 	ErrorData error;
 	try {
@@ -298,6 +324,11 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (!active_query->result_cache_key.empty() && result->type == QueryResultType::MATERIALIZED_RESULT &&
+	    !result->HasError()) {
+		auto &materialized = result->Cast<MaterializedQueryResult>();
+		QueryResultCache::Get(*this).Put(*this, active_query->result_cache_key, prepared, materialized.Collection());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -320,7 +351,8 @@ static bool IsExplainAnalyze(SQLStatement *statement) {
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const string &query,
                                                unique_ptr<SQLStatement> statement,
-                                               optional_ptr<case_insensitive_map_t<BoundParameterData>> values) {
+                                               optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
+                                               bool generic_plan) {
 	StatementType statement_type = statement->type;
 	auto result = make_shared_ptr<PreparedStatementData>(statement_type);
 
@@ -351,9 +383,12 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	// the optimizer can remove the scans of tables, e.g. when the statistics of a table show that no rows qualify
+	result->read_tables = PlanCache::GetReadTables(*plan);
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
 		profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
 		Optimizer optimizer(*planner.binder, *this);
+		optimizer.generic_plan = generic_plan;
 		plan = optimizer.Optimize(std::move(plan));
 		D_ASSERT(plan);
 		profiler.EndPhase();
@@ -379,7 +414,7 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &query, unique_ptr<SQLStatement> statement,
                                        optional_ptr<case_insensitive_map_t<BoundParameterData>> values,
-                                       PreparedStatementMode mode) {
+                                       PreparedStatementMode mode, bool generic_plan) {
 	// check if any client context state could request a rebind
 	bool can_request_rebind = false;
 	for (auto &state : registered_state->States()) {
@@ -392,7 +427,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// if any registered state can request a rebind we do the binding on a copy first
 		shared_ptr<PreparedStatementData> result;
 		try {
-			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values);
+			result = CreatePreparedStatementInternal(lock, query, statement->Copy(), values, generic_plan);
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			// check if any registered client context state wants to try a rebind
@@ -421,7 +456,7 @@ ClientContext::CreatePreparedStatement(ClientContextLock &lock, const string &qu
 		// an extension wants to do a rebind - do it once
 	}
 
-	return CreatePreparedStatementInternal(lock, query, std::move(statement), values);
+	return CreatePreparedStatementInternal(lock, query, std::move(statement), values, generic_plan);
 }
 
 QueryProgress ClientContext::GetQueryProgress() {
@@ -731,9 +766,143 @@ unique_ptr<QueryResult> ClientContext::Execute(const string &query, shared_ptr<P
 	return Execute(query, prepared, parameters);
 }
 
+unique_ptr<PendingQueryResult> ClientContext::PendingCachedResultInternal(ClientContextLock &lock,
+                                                                          const SQLStatement &statement,
+                                                                          const PendingQueryParameters &parameters,
+                                                                          string &key) {
+	auto &result_cache = QueryResultCache::Get(*this);
+	if (statement.type != StatementType::SELECT_STATEMENT || !result_cache.Enabled() ||
+	    (parameters.parameters && !parameters.parameters->empty()) || !QueryResultCache::CanUse(*this)) {
+		return nullptr;
+	}
+	key = PlanCache::GetKey(*this, statement);
+	if (key.empty()) {
+		return nullptr;
+	}
+	vector<string> names;
+	auto collection = result_cache.Lookup(*this, key, names);
+	if (!collection) {
+		return nullptr;
+	}
+	// scan the cached result instead of running the plan of the statement
+	auto prepared = make_shared_ptr<PreparedStatementData>(StatementType::SELECT_STATEMENT);
+	prepared->names = std::move(names);
+	prepared->types = collection->Types();
+	prepared->plan = make_uniq<PhysicalColumnDataScan>(prepared->types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+	                                                   collection->Count(), collection.get());
+	prepared->properties.allow_stream_result = true;
+	CheckIfPreparedStatementIsExecutable(*prepared);
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), parameters);
+	active_query->cached_result = std::move(collection);
+	key.clear();
+	return pending;
+}
+
+unique_ptr<PendingQueryResult> ClientContext::PendingCachedStatementInternal(ClientContextLock &lock,
+                                                                             const string &query,
+                                                                             const SQLStatement &statement,
+                                                                             const PendingQueryParameters &parameters) {
+	auto &plan_cache = PlanCache::Get(*this);
+	if (!plan_cache.Enabled() || (parameters.parameters && !parameters.parameters->empty()) ||
+	    !PlanCache::CanUse(*this)) {
+		return nullptr;
+	}
+	case_insensitive_map_t<BoundParameterData> values;
+	auto parameterized = PlanCache::Parameterize(statement, values);
+	if (!parameterized) {
+		return nullptr;
+	}
+	auto key = PlanCache::GetKey(*this, *parameterized);
+	if (key.empty()) {
+		return nullptr;
+	}
+	bool cacheable;
+	vector<PlanCacheTable> tables;
+	auto prepared = plan_cache.Take(key, cacheable, tables);
+	if (!cacheable) {
+		return nullptr;
+	}
+	if (prepared) {
+		bool stale;
+		try {
+			// the plan is stale if the catalog or the rows of the tables that it scans have changed
+			stale = prepared->RequireRebind(*this, &values) || !PlanCache::IsValid(*this, tables);
+		} catch (std::exception &) {
+			// e.g. a database that the plan reads from was detached
+			stale = true;
+		}
+		if (stale) {
+			prepared.reset();
+			tables.clear();
+		} else if (!PlanCache::BindValues(*prepared, values)) {
+			// the literals do not fit the plan - plan this query with the literals instead
+			plan_cache.Put(key, std::move(prepared), std::move(tables));
+			return nullptr;
+		}
+	}
+	if (!prepared) {
+		auto unbound_statement = parameterized->Copy();
+		try {
+			prepared = CreatePreparedStatement(lock, query, std::move(parameterized), nullptr,
+			                                   PreparedStatementMode::PREPARE_ONLY, true);
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (Exception::InvalidatesTransaction(error.Type())) {
+				throw;
+			}
+			// report the error of planning the original statement instead
+			return nullptr;
+		}
+		prepared->unbound_statement = std::move(unbound_statement);
+		if (!PlanCache::IsCacheable(*prepared)) {
+			plan_cache.MarkUncacheable(key);
+			return nullptr;
+		}
+		bool shareable = PlanCache::GetTableVersions(*this, *prepared, tables);
+		if (!PlanCache::BindValues(*prepared, values)) {
+			if (shareable) {
+				plan_cache.Put(key, std::move(prepared), std::move(tables));
+			}
+			return nullptr;
+		}
+		if (!shareable) {
+			// the plan was planned for rows that other transactions do not see: run it without caching it
+			key.clear();
+		}
+	}
+	PendingQueryParameters cached_parameters;
+	cached_parameters.parameters = &values;
+	cached_parameters.allow_stream_result = parameters.allow_stream_result;
+	CheckIfPreparedStatementIsExecutable(*prepared);
+	auto pending = PendingPreparedStatementInternal(lock, std::move(prepared), cached_parameters);
+	active_query->plan_cache_key = std::move(key);
+	active_query->plan_cache_tables = std::move(tables);
+	active_query->cardinality_feedback_version = CardinalityFeedback::Get(*this).GetVersion();
+	return pending;
+}
+
 unique_ptr<PendingQueryResult> ClientContext::PendingStatementInternal(ClientContextLock &lock, const string &query,
                                                                        unique_ptr<SQLStatement> statement,
                                                                        const PendingQueryParameters &parameters) {
+	string result_cache_key;
+	auto cached_result = PendingCachedResultInternal(lock, *statement, parameters, result_cache_key);
+	if (cached_result) {
+		return cached_result;
+	}
+	auto pending = PendingCachedStatementInternal(lock, query, *statement, parameters);
+	if (!pending) {
+		pending = PendingUncachedStatementInternal(lock, query, std::move(statement), parameters);
+	}
+	if (!result_cache_key.empty() && !pending->HasError() && QueryResultCache::IsCacheable(*active_query->prepared)) {
+		active_query->result_cache_key = std::move(result_cache_key);
+	}
+	return pending;
+}
+
+unique_ptr<PendingQueryResult>
+ClientContext::PendingUncachedStatementInternal(ClientContextLock &lock, const string &query,
+                                                unique_ptr<SQLStatement> statement,
+                                                const PendingQueryParameters &parameters) {
 	// prepare the query for execution
 	auto prepared = CreatePreparedStatement(lock, query, std::move(statement), parameters.parameters,
 	                                        PreparedStatementMode::PREPARE_AND_EXECUTE);
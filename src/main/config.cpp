@@ -61,6 +61,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(CardinalityFeedbackThresholdSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommit),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
@@ -74,6 +75,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DefaultNullOrderSetting),
     DUCKDB_GLOBAL(DisabledFileSystemsSetting),
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
+    DUCKDB_LOCAL(DynamicOrFilterThresholdSetting),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
     DUCKDB_GLOBAL(EnableFSSTVectors),
     DUCKDB_GLOBAL(AllowUnsignedExtensionsSetting),
@@ -100,6 +102,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(HTTPProxy),
     DUCKDB_GLOBAL(HTTPProxyUsername),
     DUCKDB_GLOBAL(HTTPProxyPassword),
+    DUCKDB_LOCAL(LateMaterializationMaxRowsSetting),
     DUCKDB_LOCAL(LogQueryPathSetting),
     DUCKDB_GLOBAL(EnableMacrosDependencies),
     DUCKDB_GLOBAL(EnableViewDependencies),
@@ -113,6 +116,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
+    DUCKDB_GLOBAL(ObjectCacheMemoryLimitSetting),
     DUCKDB_GLOBAL(OldImplicitCasting),
     DUCKDB_GLOBAL_ALIAS("memory_limit", MaximumMemorySetting),
     DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
@@ -122,6 +126,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
     DUCKDB_LOCAL(PivotLimitSetting),
+    DUCKDB_GLOBAL(PlanCacheSizeSetting),
     DUCKDB_LOCAL(PreserveIdentifierCase),
     DUCKDB_GLOBAL(PreserveInsertionOrder),
     DUCKDB_LOCAL(ProfileOutputSetting),
@@ -129,12 +134,15 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL(QueryResultCacheMemoryLimitSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_LOCAL(ScalarSubqueryErrorOnMultipleRows),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
+    DUCKDB_GLOBAL(TableSampleSizeSetting),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
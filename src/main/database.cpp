@@ -12,7 +12,10 @@
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/planner/extension_callback.hpp"
@@ -59,6 +62,10 @@ DatabaseInstance::DatabaseInstance() {
 }
 
 DatabaseInstance::~DatabaseInstance() {
+	// cached plans refer to the catalog entries of the attached databases
+	plan_cache.reset();
+	// cached results are held in blocks of the buffer manager
+	query_result_cache.reset();
 	// destroy all attached databases
 	GetDatabaseManager().ResetDatabases(scheduler);
 	// destroy child elements
@@ -281,6 +288,10 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	object_cache->SetMaxMemory(config.options.object_cache_memory_limit);
+	plan_cache = make_uniq<PlanCache>(config.options.plan_cache_size);
+	query_result_cache = make_uniq<QueryResultCache>(config.options.query_result_cache_memory_limit);
+	cardinality_feedback = make_uniq<CardinalityFeedback>();
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -360,6 +371,18 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+PlanCache &DatabaseInstance::GetPlanCache() {
+	return *plan_cache;
+}
+
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
+CardinalityFeedback &DatabaseInstance::GetCardinalityFeedback() {
+	return *cardinality_feedback;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -0,0 +1,1137 @@
+#include "duckdb/main/materialized_view.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/dependency_list.hpp"
+#include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/result_modifier.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/delete_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// View Query
+//===--------------------------------------------------------------------===//
+//! The query of a materialized view, split into the parts that are used to maintain the view
+struct ViewQuery {
+	explicit ViewQuery(LogicalOperator &plan);
+
+	//! The table that is read by the query
+	optional_ptr<TableCatalogEntry> table;
+	//! The (storage) indexes of the columns of the table that are read
+	vector<column_t> column_ids;
+	//! The types of the columns that are read
+	vector<LogicalType> scan_types;
+	//! The filter on the rows of the table (if any)
+	unique_ptr<Expression> filter;
+	//! The groups of the query (if it aggregates)
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates of the query (if it aggregates)
+	vector<unique_ptr<Expression>> aggregates;
+	//! For every column of the view: the group (or aggregate, after the groups) that it holds
+	vector<idx_t> column_sources;
+	//! For every group and aggregate: the column of the view that holds it
+	vector<idx_t> source_columns;
+	//! The expressions that compute the columns of the view (if the query does not aggregate)
+	vector<unique_ptr<Expression>> projections;
+
+	bool HasAggregates() const {
+		return !groups.empty();
+	}
+};
+
+static bool IsMaintainableAggregate(const string &name) {
+	return name == "sum" || name == "count" || name == "count_star" || name == "min" || name == "max";
+}
+
+//! Returns the aggregate that merges the results of an aggregate over different rows
+static string GetMergeAggregate(const string &name) {
+	if (name == "count" || name == "count_star") {
+		return "sum";
+	}
+	return name;
+}
+
+//! Replaces the references to the columns of the scanned table with references to the scanned chunk
+static unique_ptr<Expression> ResolveScanColumns(unique_ptr<Expression> expr, idx_t table_index) {
+	if (expr->IsVolatile()) {
+		throw BinderException("Materialized views cannot contain volatile functions");
+	}
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.depth > 0 || colref.binding.table_index != table_index) {
+			throw BinderException("Materialized views can only reference the columns of the table that they read");
+		}
+		return make_uniq<BoundReferenceExpression>(colref.alias, colref.return_type, colref.binding.column_index);
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		child = ResolveScanColumns(std::move(child), table_index);
+	});
+	return expr;
+}
+
+ViewQuery::ViewQuery(LogicalOperator &plan) {
+	static constexpr const char *UNSUPPORTED_QUERY =
+	    "Materialized views only support queries that filter, project and aggregate a single table";
+	// the plan is a projection, over an (optional) aggregate, over an (optional) filter, over a table scan
+	if (plan.type != LogicalOperatorType::LOGICAL_PROJECTION) {
+		throw BinderException(UNSUPPORTED_QUERY);
+	}
+	auto &projection = plan.Cast<LogicalProjection>();
+	auto op = projection.children[0].get();
+	optional_ptr<LogicalAggregate> aggregate;
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		aggregate = &op->Cast<LogicalAggregate>();
+		op = op->children[0].get();
+	}
+	optional_ptr<LogicalFilter> filter_op;
+	if (op->type == LogicalOperatorType::LOGICAL_FILTER) {
+		filter_op = &op->Cast<LogicalFilter>();
+		op = op->children[0].get();
+	}
+	if (op->type != LogicalOperatorType::LOGICAL_GET) {
+		throw BinderException(UNSUPPORTED_QUERY);
+	}
+	auto &get = op->Cast<LogicalGet>();
+	table = get.GetTable();
+	if (!table || !table->IsDuckTable() || !get.projection_ids.empty()) {
+		throw BinderException(UNSUPPORTED_QUERY);
+	}
+	if (table->IsMaterializedView()) {
+		throw BinderException("Materialized views cannot read other materialized views");
+	}
+	auto &columns = table->GetColumns();
+	for (auto &column_id : get.GetColumnIds()) {
+		if (IsRowIdColumnId(column_id)) {
+			throw BinderException("Materialized views must read at least one column, and cannot read row ids");
+		}
+		auto &column = columns.GetColumn(LogicalIndex(column_id));
+		column_ids.push_back(column.StorageOid());
+		scan_types.push_back(column.Type());
+	}
+
+	if (filter_op) {
+		for (auto &expr : filter_op->expressions) {
+			auto condition = ResolveScanColumns(expr->Copy(), get.table_index);
+			if (filter) {
+				filter = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(filter),
+				                                               std::move(condition));
+			} else {
+				filter = std::move(condition);
+			}
+		}
+	}
+
+	if (!aggregate) {
+		for (auto &expr : projection.expressions) {
+			projections.push_back(ResolveScanColumns(expr->Copy(), get.table_index));
+		}
+		return;
+	}
+	if (aggregate->groups.empty()) {
+		throw BinderException("Materialized views with aggregates require a GROUP BY clause");
+	}
+	if (aggregate->grouping_sets.size() > 1 || !aggregate->grouping_functions.empty()) {
+		throw BinderException("Materialized views do not support GROUPING SETS");
+	}
+	for (auto &group : aggregate->groups) {
+		groups.push_back(ResolveScanColumns(group->Copy(), get.table_index));
+	}
+	for (auto &expr : aggregate->expressions) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || !IsMaintainableAggregate(aggr.function.name)) {
+			throw BinderException("Materialized views only support the SUM, COUNT, MIN and MAX aggregates, without "
+			                      "DISTINCT, FILTER or ORDER BY");
+		}
+		auto copy = aggr.Copy();
+		for (auto &child : copy->Cast<BoundAggregateExpression>().children) {
+			child = ResolveScanColumns(std::move(child), get.table_index);
+		}
+		aggregates.push_back(std::move(copy));
+	}
+	// the columns of the view hold the groups and the aggregates
+	source_columns.resize(groups.size() + aggregates.size(), DConstants::INVALID_INDEX);
+	for (idx_t col_idx = 0; col_idx < projection.expressions.size(); col_idx++) {
+		auto &expr = *projection.expressions[col_idx];
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			throw BinderException("The columns of a materialized view with aggregates must be groups or aggregates");
+		}
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		idx_t source;
+		if (colref.binding.table_index == aggregate->group_index) {
+			source = colref.binding.column_index;
+		} else if (colref.binding.table_index == aggregate->aggregate_index) {
+			source = groups.size() + colref.binding.column_index;
+		} else {
+			throw BinderException("The columns of a materialized view with aggregates must be groups or aggregates");
+		}
+		column_sources.push_back(source);
+		if (source_columns[source] == DConstants::INVALID_INDEX) {
+			source_columns[source] = col_idx;
+		}
+	}
+	for (auto &column : source_columns) {
+		if (column == DConstants::INVALID_INDEX) {
+			throw BinderException("All groups and aggregates of a materialized view must be columns of the view");
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// View Aggregator
+//===--------------------------------------------------------------------===//
+//! Groups rows and computes the aggregates of the groups
+class ViewAggregator {
+public:
+	ViewAggregator(ClientContext &context, const vector<unique_ptr<Expression>> &groups,
+	               const vector<unique_ptr<Expression>> &aggregates);
+
+	void Sink(DataChunk &input);
+	//! Scans the groups, together with their finalized aggregates
+	void Scan(const std::function<void(DataChunk &groups, DataChunk &aggregates)> &callback);
+	//! Fetches the finalized aggregates of the groups
+	void Fetch(DataChunk &groups, DataChunk &aggregates);
+
+	idx_t Count() const {
+		return ht->Count();
+	}
+
+private:
+	ClientContext &context;
+	ExpressionExecutor group_executor;
+	ExpressionExecutor payload_executor;
+	vector<LogicalType> group_types;
+	vector<LogicalType> aggregate_types;
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+	unique_ptr<GroupedAggregateHashTable> ht;
+	unsafe_vector<idx_t> aggregate_filter;
+	//! The groups in the order in which they were found
+	ColumnDataCollection distinct_groups;
+};
+
+static vector<LogicalType> GetExpressionTypes(const vector<unique_ptr<Expression>> &expressions) {
+	vector<LogicalType> result;
+	for (auto &expr : expressions) {
+		result.push_back(expr->return_type);
+	}
+	return result;
+}
+
+ViewAggregator::ViewAggregator(ClientContext &context, const vector<unique_ptr<Expression>> &groups,
+                               const vector<unique_ptr<Expression>> &aggregates)
+    : context(context), group_executor(context, groups), payload_executor(context),
+      group_types(GetExpressionTypes(groups)), aggregate_types(GetExpressionTypes(aggregates)),
+      distinct_groups(context, group_types) {
+	vector<LogicalType> payload_types;
+	vector<BoundAggregateExpression *> bindings;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+			payload_executor.AddExpression(*child);
+		}
+		bindings.push_back(&aggr);
+		aggregate_filter.push_back(aggr_idx);
+	}
+	auto &allocator = Allocator::Get(context);
+	group_chunk.Initialize(allocator, group_types);
+	if (!payload_types.empty()) {
+		payload_chunk.Initialize(allocator, payload_types);
+	}
+	ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), group_types, payload_types,
+	                                          bindings);
+}
+
+void ViewAggregator::Sink(DataChunk &input) {
+	group_chunk.Reset();
+	group_executor.Execute(input, group_chunk);
+	payload_chunk.Reset();
+	if (payload_chunk.ColumnCount() > 0) {
+		payload_executor.Execute(input, payload_chunk);
+	}
+	payload_chunk.SetCardinality(input);
+
+	// remember the groups that were not found before
+	Vector addresses(LogicalType::POINTER);
+	SelectionVector new_groups(STANDARD_VECTOR_SIZE);
+	auto new_group_count = ht->FindOrCreateGroups(group_chunk, addresses, new_groups);
+	if (new_group_count > 0) {
+		DataChunk new_group_chunk;
+		new_group_chunk.InitializeEmpty(group_types);
+		new_group_chunk.Slice(group_chunk, new_groups, new_group_count);
+		distinct_groups.Append(new_group_chunk);
+	}
+	ht->AddChunk(group_chunk, payload_chunk, aggregate_filter);
+}
+
+void ViewAggregator::Scan(const std::function<void(DataChunk &groups, DataChunk &aggregates)> &callback) {
+	DataChunk aggregate_chunk;
+	if (!aggregate_types.empty()) {
+		aggregate_chunk.Initialize(Allocator::Get(context), aggregate_types);
+	}
+	for (auto &groups : distinct_groups.Chunks()) {
+		aggregate_chunk.Reset();
+		ht->FetchAggregates(groups, aggregate_chunk);
+		callback(groups, aggregate_chunk);
+	}
+}
+
+void ViewAggregator::Fetch(DataChunk &groups, DataChunk &aggregates) {
+	aggregates.Reset();
+	ht->FetchAggregates(groups, aggregates);
+}
+
+//===--------------------------------------------------------------------===//
+// Maintenance
+//===--------------------------------------------------------------------===//
+//! The name of the hidden column that holds the number of rows of every group of a view with aggregates
+static constexpr const char *COUNT_COLUMN_NAME = "__view_count";
+
+//! Whether or not the query of a materialized view aggregates, in which case the view has a hidden count column
+static bool HasCountColumn(const SelectStatement &query) {
+	if (query.node->type != QueryNodeType::SELECT_NODE) {
+		return false;
+	}
+	auto &node = query.node->Cast<SelectNode>();
+	return !node.groups.group_expressions.empty() || node.aggregate_handling == AggregateHandling::FORCE_AGGREGATES;
+}
+
+void MaterializedView::AddCountColumn(SelectStatement &query) {
+	if (!HasCountColumn(query)) {
+		return;
+	}
+	auto count = make_uniq<FunctionExpression>("count_star", vector<unique_ptr<ParsedExpression>>());
+	count->alias = COUNT_COLUMN_NAME;
+	query.node->Cast<SelectNode>().select_list.push_back(std::move(count));
+}
+
+bool MaterializedView::IsCountColumn(const TableCatalogEntry &table, const ColumnDefinition &column) {
+	if (!table.IsMaterializedView() || column.Name() != COUNT_COLUMN_NAME) {
+		return false;
+	}
+	auto &columns = table.GetColumns();
+	return column.Logical().index + 1 == columns.LogicalColumnCount() && HasCountColumn(table.GetViewQuery());
+}
+
+//! Binds the query that computes the rows of the view, including the hidden count column
+static BoundStatement BindStoredQuery(ClientContext &context, const TableCatalogEntry &view) {
+	auto statement = view.GetViewQuery().Copy();
+	MaterializedView::AddCountColumn(statement->Cast<SelectStatement>());
+	auto binder = Binder::CreateBinder(context);
+	// the query is bound as it is: it is not answered from a materialized view
+	binder->SetCatalogLookupCallback([](CatalogEntry &) {});
+	return binder->Bind(*statement);
+}
+
+//! Scans the rows of the table that are visible to the transaction, or only the rows that it inserted
+static void ScanTable(DuckTransaction &transaction, DataTable &storage, const vector<column_t> &column_ids,
+                      const vector<LogicalType> &types, bool inserted_only,
+                      const std::function<void(DataChunk &chunk)> &callback) {
+	auto &local_storage = LocalStorage::Get(transaction);
+	TableScanState state;
+	if (inserted_only) {
+		state.Initialize(column_ids);
+		local_storage.InitializeScan(storage, state.local_state, nullptr);
+	} else {
+		storage.InitializeScan(transaction, state, column_ids);
+	}
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
+	while (true) {
+		chunk.Reset();
+		if (inserted_only) {
+			local_storage.Scan(state.local_state, column_ids, chunk);
+		} else {
+			storage.Scan(transaction, chunk, state);
+		}
+		if (chunk.size() == 0) {
+			break;
+		}
+		callback(chunk);
+	}
+}
+
+//! The rows of the table of a view that pass the filter of the view, and the changes that the transaction made to them
+class TableChanges {
+public:
+	TableChanges(ClientContext &context, DuckTransaction &transaction, DataTable &storage, const ViewQuery &query,
+	             bool modified)
+	    : transaction(transaction), storage(storage), query(query), filter_sel(STANDARD_VECTOR_SIZE) {
+		if (query.filter) {
+			filter_executor = make_uniq<ExpressionExecutor>(context, *query.filter);
+		}
+		if (modified) {
+			modified_rows = transaction.GetModifiedRows(storage);
+		}
+	}
+
+	//! Scans the rows that the transaction added: the inserted rows, and the new versions of the updated rows
+	void ScanAdded(const std::function<void(DataChunk &chunk)> &callback) {
+		ScanTable(transaction, storage, query.column_ids, query.scan_types, true,
+		          [&](DataChunk &chunk) { FilterRows(chunk, callback); });
+		FetchModifiedRows(transaction, callback);
+	}
+
+	//! Scans the rows that the transaction removed: the deleted rows, and the old versions of the updated rows
+	void ScanRemoved(const std::function<void(DataChunk &chunk)> &callback) {
+		// the rows as they were when the transaction started, without the deletes and updates of the transaction
+		FetchModifiedRows(TransactionData(MAX_TRANSACTION_ID, transaction.start_time), callback);
+	}
+
+	//! Scans the rows of the table that are visible to the transaction
+	void ScanAll(const std::function<void(DataChunk &chunk)> &callback) {
+		ScanTable(transaction, storage, query.column_ids, query.scan_types, false,
+		          [&](DataChunk &chunk) { FilterRows(chunk, callback); });
+	}
+
+private:
+	void FilterRows(DataChunk &chunk, const std::function<void(DataChunk &chunk)> &callback) {
+		if (filter_executor) {
+			auto count = filter_executor->SelectExpression(chunk, filter_sel);
+			if (count < chunk.size()) {
+				chunk.Slice(filter_sel, count);
+			}
+		}
+		if (chunk.size() > 0) {
+			callback(chunk);
+		}
+	}
+
+	void FetchModifiedRows(TransactionData transaction_data, const std::function<void(DataChunk &chunk)> &callback) {
+		Vector row_ids(LogicalType::ROW_TYPE);
+		auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+		DataChunk chunk;
+		chunk.Initialize(Allocator::DefaultAllocator(), query.scan_types);
+		ColumnFetchState fetch_state;
+		for (idx_t offset = 0; offset < modified_rows.size(); offset += STANDARD_VECTOR_SIZE) {
+			auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, modified_rows.size() - offset);
+			for (idx_t i = 0; i < count; i++) {
+				row_id_data[i] = modified_rows[offset + i];
+			}
+			// the rows that are not visible (i.e. the deleted rows, for the new versions) are skipped
+			chunk.Reset();
+			storage.Fetch(transaction_data, chunk, query.column_ids, row_ids, count, fetch_state);
+			FilterRows(chunk, callback);
+		}
+	}
+
+private:
+	DuckTransaction &transaction;
+	DataTable &storage;
+	const ViewQuery &query;
+	unique_ptr<ExpressionExecutor> filter_executor;
+	SelectionVector filter_sel;
+	//! The rows of the table that the transaction deleted or updated
+	vector<row_t> modified_rows;
+};
+
+//! Deletes rows of the view. The rows that a concurrent transaction changed are conflicts.
+static void DeleteRows(ClientContext &context, TableCatalogEntry &view, const vector<row_t> &rows) {
+	if (rows.empty()) {
+		return;
+	}
+	auto &storage = view.GetStorage();
+	// materialized views do not have constraints
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	auto delete_state = storage.InitializeDelete(view, context, bound_constraints);
+	Vector row_ids(LogicalType::ROW_TYPE);
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+	for (idx_t offset = 0; offset < rows.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, rows.size() - offset);
+		for (idx_t i = 0; i < count; i++) {
+			row_id_data[i] = rows[offset + i];
+		}
+		storage.Delete(*delete_state, context, row_ids, count);
+	}
+}
+
+static void AppendRows(ClientContext &context, TableCatalogEntry &view, ColumnDataCollection &rows) {
+	if (rows.Count() == 0) {
+		return;
+	}
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	view.GetStorage().LocalAppend(view, context, rows, bound_constraints);
+}
+
+//! Computes rows of the view from the groups and aggregates of its query
+static void ComputeViewChunk(ClientContext &context, const ViewQuery &query, DataChunk &groups, DataChunk &aggregates,
+                             DataChunk &result) {
+	result.Reset();
+	for (idx_t col_idx = 0; col_idx < result.ColumnCount(); col_idx++) {
+		auto source = query.column_sources[col_idx];
+		auto &source_vector =
+		    source < groups.ColumnCount() ? groups.data[source] : aggregates.data[source - groups.ColumnCount()];
+		if (source_vector.GetType() == result.data[col_idx].GetType()) {
+			result.data[col_idx].Reference(source_vector);
+		} else {
+			VectorOperations::Cast(context, source_vector, result.data[col_idx], groups.size());
+		}
+	}
+	result.SetCardinality(groups.size());
+}
+
+static unique_ptr<Expression> BindMergeAggregate(ClientContext &context, const string &name, const LogicalType &type,
+                                                 idx_t column) {
+	auto &entry = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, name);
+	FunctionBinder function_binder(context);
+	vector<unique_ptr<Expression>> children;
+	children.push_back(make_uniq<BoundReferenceExpression>(type, column));
+	ErrorData error;
+	auto best_function = function_binder.BindFunction(name, entry.functions, children, error);
+	if (!best_function.IsValid()) {
+		error.Throw();
+	}
+	auto function = entry.functions.GetFunctionByOffset(best_function.GetIndex());
+	return function_binder.BindAggregateFunction(function, std::move(children));
+}
+
+static unique_ptr<Expression> BindNegation(ClientContext &context, const LogicalType &type, idx_t column) {
+	FunctionBinder function_binder(context);
+	vector<unique_ptr<Expression>> children;
+	children.push_back(make_uniq<BoundReferenceExpression>(type, column));
+	ErrorData error;
+	auto result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, "-", std::move(children), error, true);
+	if (!result) {
+		error.Throw();
+	}
+	return BoundCastExpression::AddCastToType(context, std::move(result), type);
+}
+
+static vector<idx_t> GetColumnIndexes(idx_t column_count) {
+	vector<idx_t> result;
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		result.push_back(col_idx);
+	}
+	return result;
+}
+
+//! Returns the values of the first columns of a row as a struct, so equal rows can be found
+static Value GetRowValue(DataChunk &chunk, idx_t column_count, idx_t row) {
+	child_list_t<Value> values;
+	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
+		values.emplace_back(to_string(col_idx), chunk.GetValue(col_idx, row));
+	}
+	return Value::STRUCT(std::move(values));
+}
+
+//! Maintains a view without aggregates: the rows that the transaction added are appended to the view, and for every
+//! row that it removed, an equal row of the view is deleted
+static void MaintainProjection(ClientContext &context, TableCatalogEntry &view, const ViewQuery &query,
+                               TableChanges &changes) {
+	auto &transaction = DuckTransaction::Get(context, view.ParentCatalog());
+	auto view_types = view.GetTypes();
+	auto view_columns = GetColumnIndexes(view_types.size());
+	ExpressionExecutor projection_executor(context, query.projections);
+	DataChunk view_chunk;
+	view_chunk.Initialize(Allocator::Get(context), view_types);
+	Vector hashes(LogicalType::HASH);
+
+	// count the removed rows, and keep their hashes to skip the other rows of the view quickly
+	value_map_t<idx_t> removed_rows;
+	unordered_set<hash_t> removed_hashes;
+	changes.ScanRemoved([&](DataChunk &chunk) {
+		view_chunk.Reset();
+		projection_executor.Execute(chunk, view_chunk);
+		view_chunk.Hash(view_columns, hashes);
+		hashes.Flatten(view_chunk.size());
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < view_chunk.size(); i++) {
+			removed_hashes.insert(hash_data[i]);
+			removed_rows[GetRowValue(view_chunk, view_types.size(), i)]++;
+		}
+	});
+	vector<row_t> deleted_rows;
+	if (!removed_rows.empty()) {
+		auto column_ids = view_columns;
+		column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		auto scan_types = view_types;
+		scan_types.push_back(LogicalType::ROW_TYPE);
+		ScanTable(transaction, view.GetStorage(), column_ids, scan_types, false, [&](DataChunk &chunk) {
+			chunk.Hash(view_columns, hashes);
+			hashes.Flatten(chunk.size());
+			auto hash_data = FlatVector::GetData<hash_t>(hashes);
+			for (idx_t i = 0; i < chunk.size(); i++) {
+				if (removed_hashes.find(hash_data[i]) == removed_hashes.end()) {
+					continue;
+				}
+				auto entry = removed_rows.find(GetRowValue(chunk, view_types.size(), i));
+				if (entry == removed_rows.end() || entry->second == 0) {
+					continue;
+				}
+				entry->second--;
+				deleted_rows.push_back(chunk.GetValue(view_types.size(), i).GetValue<row_t>());
+			}
+		});
+	}
+	DeleteRows(context, view, deleted_rows);
+
+	ColumnDataCollection rows(context, view_types);
+	changes.ScanAdded([&](DataChunk &chunk) {
+		view_chunk.Reset();
+		projection_executor.Execute(chunk, view_chunk);
+		rows.Append(view_chunk);
+	});
+	AppendRows(context, view, rows);
+}
+
+//! Whether or not the aggregate of a group has to be computed again from the table, because rows were removed from it
+static bool RequiresRecompute(const string &name, const Value &merged, const Value &removed) {
+	if (removed.IsNull()) {
+		return false;
+	}
+	if (name == "min") {
+		// the minimum was removed (unless a smaller value remains)
+		return merged.IsNull() || !(removed > merged);
+	}
+	if (name == "max") {
+		return merged.IsNull() || !(removed < merged);
+	}
+	if (name == "sum") {
+		// a sum of zero can also be the sum of no values (i.e. NULL), and floating point sums are not exact
+		auto type = merged.type().id();
+		return merged.IsNull() || type == LogicalTypeId::FLOAT || type == LogicalTypeId::DOUBLE ||
+		       merged.GetValue<double>() == 0;
+	}
+	return false;
+}
+
+//! Maintains a view with aggregates. The aggregates of the rows that the transaction added and removed are merged
+//! with the rows of the view that hold the same groups: counts and sums are added up (the ones of the removed rows
+//! negated), and the minimum (or maximum) of the minimums (or maximums) is taken. Only the rows of these groups are
+//! replaced. Groups whose count drops to zero are deleted, and groups whose minimum or maximum may have been removed
+//! are computed again from the table.
+static void MaintainAggregates(ClientContext &context, TableCatalogEntry &view, const ViewQuery &query,
+                               TableChanges &changes) {
+	auto &transaction = DuckTransaction::Get(context, view.ParentCatalog());
+	auto &allocator = Allocator::Get(context);
+	auto view_types = view.GetTypes();
+	auto group_count = query.groups.size();
+	auto aggregate_count = query.aggregates.size();
+	// the hidden count column is the last column of the view
+	auto count_column = view_types.size() - 1;
+
+	ViewAggregator added(context, query.groups, query.aggregates);
+	changes.ScanAdded([&](DataChunk &chunk) { added.Sink(chunk); });
+	ViewAggregator removed(context, query.groups, query.aggregates);
+	changes.ScanRemoved([&](DataChunk &chunk) { removed.Sink(chunk); });
+	if (added.Count() == 0 && removed.Count() == 0) {
+		// none of the changed rows pass the filter
+		return;
+	}
+
+	// the rows that are merged hold the columns of the view, whether or not the row is a change, the row id of the
+	// row of the view, and the aggregates of the removed rows
+	auto merge_types = view_types;
+	auto change_column = merge_types.size();
+	merge_types.push_back(LogicalType::BIGINT);
+	auto row_id_column = merge_types.size();
+	merge_types.push_back(LogicalType::ROW_TYPE);
+	auto removed_column = merge_types.size();
+	vector<string> aggregate_names;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+		aggregate_names.push_back(query.aggregates[aggr_idx]->Cast<BoundAggregateExpression>().function.name);
+		merge_types.push_back(view_types[query.source_columns[group_count + aggr_idx]]);
+	}
+	vector<idx_t> group_columns;
+	vector<unique_ptr<Expression>> merge_groups;
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		auto column = query.source_columns[group_idx];
+		group_columns.push_back(column);
+		merge_groups.push_back(make_uniq<BoundReferenceExpression>(view_types[column], column));
+	}
+	vector<unique_ptr<Expression>> merge_aggregates;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+		auto column = query.source_columns[group_count + aggr_idx];
+		merge_aggregates.push_back(
+		    BindMergeAggregate(context, GetMergeAggregate(aggregate_names[aggr_idx]), view_types[column], column));
+	}
+	merge_aggregates.push_back(BindMergeAggregate(context, "max", LogicalType::BIGINT, change_column));
+	merge_aggregates.push_back(BindMergeAggregate(context, "max", LogicalType::ROW_TYPE, row_id_column));
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+		// the smallest removed minimum (or largest removed maximum) is the one that can have been the extreme
+		auto name = aggregate_names[aggr_idx] == "max" ? "max" : "min";
+		merge_aggregates.push_back(
+		    BindMergeAggregate(context, name, merge_types[removed_column + aggr_idx], removed_column + aggr_idx));
+	}
+	ViewAggregator merger(context, merge_groups, merge_aggregates);
+
+	// the changes of the removed rows: their counts and sums are negated, and their minimums and maximums are left out
+	vector<unique_ptr<Expression>> removed_expressions;
+	for (idx_t col_idx = 0; col_idx < view_types.size(); col_idx++) {
+		auto source = query.column_sources[col_idx];
+		auto &type = view_types[col_idx];
+		if (source < group_count) {
+			removed_expressions.push_back(make_uniq<BoundReferenceExpression>(type, col_idx));
+		} else if (aggregate_names[source - group_count] == "min" || aggregate_names[source - group_count] == "max") {
+			removed_expressions.push_back(make_uniq<BoundConstantExpression>(Value(type)));
+		} else {
+			removed_expressions.push_back(BindNegation(context, type, col_idx));
+		}
+	}
+	ExpressionExecutor removed_executor(context, removed_expressions);
+
+	DataChunk view_chunk;
+	view_chunk.Initialize(allocator, view_types);
+	DataChunk change_chunk;
+	change_chunk.Initialize(allocator, view_types);
+	DataChunk merge_chunk;
+	merge_chunk.InitializeEmpty(merge_types);
+	Vector hashes(LogicalType::HASH);
+	// the hashes of the changed groups, to skip the other rows of the view quickly
+	unordered_set<hash_t> changed_hashes;
+	auto sink_changes = [&](DataChunk &groups, DataChunk &aggregates, bool is_removed) {
+		ComputeViewChunk(context, query, groups, aggregates, view_chunk);
+		change_chunk.Reset();
+		if (is_removed) {
+			removed_executor.Execute(view_chunk, change_chunk);
+		} else {
+			change_chunk.Reference(view_chunk);
+		}
+		for (idx_t col_idx = 0; col_idx < view_types.size(); col_idx++) {
+			merge_chunk.data[col_idx].Reference(change_chunk.data[col_idx]);
+		}
+		merge_chunk.data[change_column].Reference(Value::BIGINT(1));
+		merge_chunk.data[row_id_column].Reference(Value(LogicalType::ROW_TYPE));
+		for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+			auto &removed_vector = merge_chunk.data[removed_column + aggr_idx];
+			if (is_removed) {
+				removed_vector.Reference(view_chunk.data[query.source_columns[group_count + aggr_idx]]);
+			} else {
+				removed_vector.Reference(Value(removed_vector.GetType()));
+			}
+		}
+		merge_chunk.SetCardinality(view_chunk);
+		merger.Sink(merge_chunk);
+
+		merge_chunk.Hash(group_columns, hashes);
+		hashes.Flatten(merge_chunk.size());
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < merge_chunk.size(); i++) {
+			changed_hashes.insert(hash_data[i]);
+		}
+	};
+	added.Scan([&](DataChunk &groups, DataChunk &aggregates) { sink_changes(groups, aggregates, false); });
+	removed.Scan([&](DataChunk &groups, DataChunk &aggregates) { sink_changes(groups, aggregates, true); });
+
+	// merge the rows of the view that (likely) hold the changed groups
+	auto column_ids = GetColumnIndexes(view_types.size());
+	column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	auto scan_types = view_types;
+	scan_types.push_back(LogicalType::ROW_TYPE);
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	ScanTable(transaction, view.GetStorage(), column_ids, scan_types, false, [&](DataChunk &chunk) {
+		chunk.Hash(group_columns, hashes);
+		hashes.Flatten(chunk.size());
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		idx_t count = 0;
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			if (changed_hashes.find(hash_data[i]) != changed_hashes.end()) {
+				sel.set_index(count++, i);
+			}
+		}
+		if (count == 0) {
+			return;
+		}
+		chunk.Slice(sel, count);
+		for (idx_t col_idx = 0; col_idx < view_types.size(); col_idx++) {
+			merge_chunk.data[col_idx].Reference(chunk.data[col_idx]);
+		}
+		merge_chunk.data[change_column].Reference(Value::BIGINT(0));
+		merge_chunk.data[row_id_column].Reference(chunk.data[view_types.size()]);
+		for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+			auto &removed_vector = merge_chunk.data[removed_column + aggr_idx];
+			removed_vector.Reference(Value(removed_vector.GetType()));
+		}
+		merge_chunk.SetCardinality(chunk);
+		merger.Sink(merge_chunk);
+	});
+
+	// replace the rows of the changed groups
+	vector<row_t> deleted_rows;
+	ColumnDataCollection rows(context, view_types);
+	ColumnDataCollection recompute_groups(context, GetExpressionTypes(query.groups));
+	bool has_new_groups = false;
+	SelectionVector append_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector recompute_sel(STANDARD_VECTOR_SIZE);
+	DataChunk slice;
+	merger.Scan([&](DataChunk &groups, DataChunk &aggregates) {
+		ComputeViewChunk(context, query, groups, aggregates, view_chunk);
+		idx_t append_count = 0;
+		idx_t recompute_count = 0;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			if (aggregates.GetValue(aggregate_count, i).GetValue<int64_t>() == 0) {
+				// the group was not changed: its hash is equal to the hash of a changed group
+				continue;
+			}
+			auto row_id = aggregates.GetValue(aggregate_count + 1, i);
+			if (!row_id.IsNull()) {
+				deleted_rows.push_back(row_id.GetValue<row_t>());
+			}
+			if (view_chunk.GetValue(count_column, i).GetValue<int64_t>() == 0) {
+				// all rows of the group were removed
+				continue;
+			}
+			if (row_id.IsNull()) {
+				has_new_groups = true;
+			}
+			bool recompute = false;
+			for (idx_t aggr_idx = 0; aggr_idx < aggregate_count && !recompute; aggr_idx++) {
+				auto merged = view_chunk.GetValue(query.source_columns[group_count + aggr_idx], i);
+				auto removed_value = aggregates.GetValue(aggregate_count + 2 + aggr_idx, i);
+				recompute = RequiresRecompute(aggregate_names[aggr_idx], merged, removed_value);
+			}
+			if (recompute) {
+				recompute_sel.set_index(recompute_count++, i);
+			} else {
+				append_sel.set_index(append_count++, i);
+			}
+		}
+		if (append_count > 0) {
+			slice.InitializeEmpty(view_types);
+			slice.Slice(view_chunk, append_sel, append_count);
+			rows.Append(slice);
+			slice.Destroy();
+		}
+		if (recompute_count > 0) {
+			slice.InitializeEmpty(groups.GetTypes());
+			slice.Slice(groups, recompute_sel, recompute_count);
+			recompute_groups.Append(slice);
+			slice.Destroy();
+		}
+	});
+	if (recompute_groups.Count() > 0) {
+		ViewAggregator aggregator(context, query.groups, query.aggregates);
+		changes.ScanAll([&](DataChunk &chunk) { aggregator.Sink(chunk); });
+		DataChunk aggregate_chunk;
+		aggregate_chunk.Initialize(allocator, GetExpressionTypes(query.aggregates));
+		for (auto &groups : recompute_groups.Chunks()) {
+			aggregator.Fetch(groups, aggregate_chunk);
+			ComputeViewChunk(context, query, groups, aggregate_chunk, view_chunk);
+			rows.Append(view_chunk);
+		}
+	}
+	if (has_new_groups) {
+		// a concurrent transaction can add the same group to the view, which is not a conflict on any row of the view
+		transaction.RequireUnchangedTable(view.GetStorage());
+	}
+	DeleteRows(context, view, deleted_rows);
+	AppendRows(context, view, rows);
+}
+
+static void MaintainView(ClientContext &context, TableCatalogEntry &view, bool modified) {
+	auto bound_query = BindStoredQuery(context, view);
+	ViewQuery query(*bound_query.plan);
+	if (bound_query.types != view.GetTypes()) {
+		throw InvalidInputException("The query of materialized view \"%s\" no longer matches the columns of the view",
+		                            view.name);
+	}
+	auto &transaction = DuckTransaction::Get(context, view.ParentCatalog());
+	TableChanges changes(context, transaction, query.table->GetStorage(), query, modified);
+	if (query.HasAggregates()) {
+		MaintainAggregates(context, view, query, changes);
+	} else {
+		MaintainProjection(context, view, query, changes);
+	}
+}
+
+TableCatalogEntry &MaterializedView::VerifyQuery(LogicalOperator &plan) {
+	ViewQuery query(plan);
+	return *query.table;
+}
+
+LogicalDependencyList MaterializedView::GetDependencies(const SelectStatement &query, SchemaCatalogEntry &schema) {
+	LogicalDependencyList result;
+	if (query.node->type != QueryNodeType::SELECT_NODE) {
+		return result;
+	}
+	auto &node = query.node->Cast<SelectNode>();
+	if (node.from_table->type != TableReferenceType::BASE_TABLE) {
+		return result;
+	}
+	auto &table_ref = node.from_table->Cast<BaseTableRef>();
+	LogicalDependency dependency;
+	dependency.catalog = schema.ParentCatalog().GetName();
+	dependency.entry.type = CatalogType::TABLE_ENTRY;
+	// an unqualified table is assumed to be in the schema of the view
+	dependency.entry.schema = table_ref.schema_name.empty() ? schema.name : table_ref.schema_name;
+	dependency.entry.name = table_ref.table_name;
+	result.AddDependency(dependency);
+	return result;
+}
+
+vector<reference<TableCatalogEntry>> MaterializedView::GetViews(ClientContext &context, TableCatalogEntry &table) {
+	vector<reference<TableCatalogEntry>> result;
+	auto &catalog = table.ParentCatalog();
+	if (!catalog.IsDuckCatalog()) {
+		return result;
+	}
+	auto &dependency_manager = catalog.Cast<DuckCatalog>().GetDependencyManager();
+	for (auto &entry : dependency_manager.GetDependents(catalog.GetCatalogTransaction(context), table)) {
+		if (entry.get().type != CatalogType::TABLE_ENTRY) {
+			continue;
+		}
+		auto &view = entry.get().Cast<TableCatalogEntry>();
+		if (view.IsMaterializedView()) {
+			result.push_back(view);
+		}
+	}
+	return result;
+}
+
+void MaterializedView::MaintainViews(ClientContext &context, AttachedDatabase &db) {
+	auto &catalog = db.GetCatalog();
+	if (!catalog.IsDuckCatalog()) {
+		return;
+	}
+	auto &storage_manager = db.GetStorageManager();
+	if (!storage_manager.InMemory() && !storage_manager.IsLoaded()) {
+		// the changes that are replayed from the WAL already include the changes to the views
+		return;
+	}
+	auto &transaction = DuckTransaction::Get(context, db);
+	auto &local_storage = LocalStorage::Get(transaction);
+	// the tables in which rows were inserted, deleted or updated
+	auto tables = local_storage.GetTables();
+	for (auto &table : transaction.GetModifiedTables()) {
+		if (!local_storage.Find(table)) {
+			tables.push_back(table);
+		}
+	}
+	for (auto &table_ref : tables) {
+		auto &storage = table_ref.get();
+		auto entry = catalog.GetEntry(context, CatalogType::TABLE_ENTRY, storage.GetDataTableInfo()->GetSchemaName(),
+		                              storage.GetTableName(), OnEntryNotFound::RETURN_NULL);
+		if (!entry || entry->type != CatalogType::TABLE_ENTRY) {
+			continue;
+		}
+		auto &table = entry->Cast<TableCatalogEntry>();
+		if (!table.IsDuckTable() || &table.GetStorage() != &storage) {
+			// the table was dropped or altered
+			continue;
+		}
+		auto modified = transaction.IsModifiedTable(storage);
+		for (auto &view : GetViews(context, table)) {
+			MaintainView(context, view.get(), modified);
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Rewrite
+//===--------------------------------------------------------------------===//
+//! Whether or not the expression of a result modifier only references the columns of the result of the query
+static bool ReferencesOutputColumns(const ParsedExpression &expr, const case_insensitive_set_t &output_names) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::CONSTANT:
+	case ExpressionClass::STAR:
+		return true;
+	case ExpressionClass::COLUMN_REF: {
+		auto &colref = expr.Cast<ColumnRefExpression>();
+		return !colref.IsQualified() && output_names.find(colref.GetColumnName()) != output_names.end();
+	}
+	default:
+		return false;
+	}
+}
+
+static bool CanRewriteModifier(ResultModifier &modifier, const case_insensitive_set_t &output_names) {
+	switch (modifier.type) {
+	case ResultModifierType::ORDER_MODIFIER: {
+		for (auto &order : modifier.Cast<OrderModifier>().orders) {
+			if (!ReferencesOutputColumns(*order.expression, output_names)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case ResultModifierType::LIMIT_MODIFIER: {
+		auto &limit = modifier.Cast<LimitModifier>();
+		return (!limit.limit || limit.limit->GetExpressionClass() == ExpressionClass::CONSTANT) &&
+		       (!limit.offset || limit.offset->GetExpressionClass() == ExpressionClass::CONSTANT);
+	}
+	case ResultModifierType::DISTINCT_MODIFIER: {
+		for (auto &target : modifier.Cast<DistinctModifier>().distinct_on_targets) {
+			if (!ReferencesOutputColumns(*target, output_names)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool HasStar(const SelectNode &node) {
+	for (auto &expr : node.select_list) {
+		if (expr->GetExpressionClass() == ExpressionClass::STAR) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! Whether or not the query of the view is equal to the query. The names of the columns of the result are ignored
+//! (unless the query selects a star), as the rewritten query selects the columns of the view under their names.
+static bool EqualsViewQuery(const SelectNode &query, const TableCatalogEntry &view, bool has_star) {
+	auto &view_node = *view.GetViewQuery().node;
+	if (has_star) {
+		return query.Equals(&view_node);
+	}
+	auto left = query.Copy();
+	auto right = view_node.Copy();
+	if (right->type != QueryNodeType::SELECT_NODE) {
+		return false;
+	}
+	for (auto &expr : left->Cast<SelectNode>().select_list) {
+		expr->alias.clear();
+	}
+	for (auto &expr : right->Cast<SelectNode>().select_list) {
+		expr->alias.clear();
+	}
+	return left->Equals(right.get());
+}
+
+//! Whether or not the query of the view, bound against the current table, still computes the columns of the view
+static bool ViewMatchesTable(ClientContext &context, TableCatalogEntry &view, TableCatalogEntry &table) {
+	try {
+		auto bound_query = BindStoredQuery(context, view);
+		ViewQuery query(*bound_query.plan);
+		return query.table.get() == &table && bound_query.types == view.GetTypes();
+	} catch (std::exception &ex) {
+		// the query of the view can no longer be bound: it is answered from the table
+		return false;
+	}
+}
+
+bool MaterializedView::TryRewrite(Binder &binder, SelectNode &node) {
+	if (!node.from_table || node.from_table->type != TableReferenceType::BASE_TABLE || !node.cte_map.map.empty()) {
+		return false;
+	}
+	auto &ref = node.from_table->Cast<BaseTableRef>();
+	if (ref.sample || !binder.FindCTE(ref.table_name).empty()) {
+		return false;
+	}
+	auto &context = binder.context;
+	auto entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, ref.catalog_name, ref.schema_name,
+	                               ref.table_name, OnEntryNotFound::RETURN_NULL);
+	if (!entry || entry->type != CatalogType::TABLE_ENTRY) {
+		return false;
+	}
+	auto &table = entry->Cast<TableCatalogEntry>();
+	if (!table.IsDuckTable() || table.IsMaterializedView()) {
+		return false;
+	}
+	auto views = GetViews(context, table);
+	if (views.empty()) {
+		return false;
+	}
+	// the views are maintained when a transaction commits: they do not contain the changes of the current transaction
+	auto &transaction = DuckTransaction::Get(context, table.ParentCatalog());
+	auto &storage = table.GetStorage();
+	if (LocalStorage::Get(transaction).Find(storage) || transaction.IsModifiedTable(storage)) {
+		return false;
+	}
+	auto query = node.Copy();
+	query->modifiers.clear();
+	auto &query_node = query->Cast<SelectNode>();
+	auto has_star = HasStar(query_node);
+	for (auto &view_ref : views) {
+		auto &view = view_ref.get();
+		if (!EqualsViewQuery(query_node, view, has_star)) {
+			continue;
+		}
+		// the visible columns of the view hold the columns of the result of the query, in order
+		vector<string> view_names;
+		case_insensitive_set_t distinct_names;
+		for (auto &column : view.GetColumns().Logical()) {
+			if (!IsCountColumn(view, column)) {
+				view_names.push_back(column.Name());
+				distinct_names.insert(column.Name());
+			}
+		}
+		if (distinct_names.size() != view_names.size() || (!has_star && view_names.size() != node.select_list.size())) {
+			continue;
+		}
+		// the result modifiers are applied to the columns of the result of the query
+		case_insensitive_set_t output_names;
+		if (has_star) {
+			output_names = distinct_names;
+		} else {
+			for (auto &expr : node.select_list) {
+				output_names.insert(expr->GetName());
+			}
+		}
+		bool can_rewrite = true;
+		for (auto &modifier : node.modifiers) {
+			can_rewrite = can_rewrite && CanRewriteModifier(*modifier, output_names);
+		}
+		if (!can_rewrite || !ViewMatchesTable(context, view, table)) {
+			continue;
+		}
+		// scan the view instead, and apply the result modifiers to its rows
+		auto view_table = make_uniq<BaseTableRef>();
+		view_table->catalog_name = view.ParentCatalog().GetName();
+		view_table->schema_name = view.ParentSchema().name;
+		view_table->table_name = view.name;
+		vector<unique_ptr<ParsedExpression>> select_list;
+		if (has_star) {
+			select_list.push_back(make_uniq<StarExpression>());
+		} else {
+			// keep the names of the columns of the result of the query
+			for (idx_t col_idx = 0; col_idx < view_names.size(); col_idx++) {
+				auto column = make_uniq<ColumnRefExpression>(view_names[col_idx], view.name);
+				column->alias = node.select_list[col_idx]->GetName();
+				select_list.push_back(std::move(column));
+			}
+		}
+		node.select_list = std::move(select_list);
+		node.from_table = std::move(view_table);
+		node.where_clause.reset();
+		node.groups.group_expressions.clear();
+		node.groups.grouping_sets.clear();
+		node.having.reset();
+		node.qualify.reset();
+		node.sample.reset();
+		node.aggregate_handling = AggregateHandling::STANDARD_HANDLING;
+		return true;
+	}
+	return false;
+}
+
+} // namespace duckdb
@@ -0,0 +1,483 @@
+#include "duckdb/main/plan_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/list.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/query_node/list.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/list.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+PlanCache::PlanCache(idx_t max_entries_p) : max_entries(max_entries_p) {
+}
+
+PlanCache &PlanCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetPlanCache();
+}
+
+//===--------------------------------------------------------------------===//
+// Statement Normalization
+//===--------------------------------------------------------------------===//
+//! Replaces the literals that are compared against in WHERE clauses with positional parameters
+class LiteralParameterizer {
+public:
+	explicit LiteralParameterizer(case_insensitive_map_t<BoundParameterData> &values) : values(values) {
+	}
+
+	void VisitQueryNode(QueryNode &node) {
+		switch (node.type) {
+		case QueryNodeType::SELECT_NODE: {
+			auto &select = node.Cast<SelectNode>();
+			if (select.where_clause) {
+				ParameterizeFilter(*select.where_clause);
+			}
+			for (auto &expr : select.select_list) {
+				VisitExpression(*expr);
+			}
+			for (auto &expr : select.groups.group_expressions) {
+				VisitExpression(*expr);
+			}
+			for (auto expr : {select.where_clause.get(), select.having.get(), select.qualify.get()}) {
+				if (expr) {
+					VisitExpression(*expr);
+				}
+			}
+			VisitTableRef(*select.from_table);
+			break;
+		}
+		case QueryNodeType::SET_OPERATION_NODE: {
+			auto &setop = node.Cast<SetOperationNode>();
+			VisitQueryNode(*setop.left);
+			VisitQueryNode(*setop.right);
+			break;
+		}
+		case QueryNodeType::CTE_NODE: {
+			auto &cte = node.Cast<CTENode>();
+			VisitQueryNode(*cte.query);
+			VisitQueryNode(*cte.child);
+			break;
+		}
+		case QueryNodeType::RECURSIVE_CTE_NODE: {
+			auto &cte = node.Cast<RecursiveCTENode>();
+			VisitQueryNode(*cte.left);
+			VisitQueryNode(*cte.right);
+			break;
+		}
+		default:
+			throw NotImplementedException("Unsupported query node in the plan cache");
+		}
+		ParsedExpressionIterator::EnumerateQueryNodeModifiers(
+		    node, [&](unique_ptr<ParsedExpression> &child) { VisitExpression(*child); });
+		for (auto &entry : node.cte_map.map) {
+			VisitQueryNode(*entry.second->query->node);
+		}
+	}
+
+private:
+	//! Visits the subqueries of an expression
+	void VisitExpression(ParsedExpression &expr) {
+		if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+			VisitQueryNode(*expr.Cast<SubqueryExpression>().subquery->node);
+		}
+		ParsedExpressionIterator::EnumerateChildren(expr, [&](ParsedExpression &child) { VisitExpression(child); });
+	}
+
+	void VisitTableRef(TableRef &ref) {
+		switch (ref.type) {
+		case TableReferenceType::JOIN: {
+			auto &join = ref.Cast<JoinRef>();
+			VisitTableRef(*join.left);
+			VisitTableRef(*join.right);
+			if (join.condition) {
+				VisitExpression(*join.condition);
+			}
+			break;
+		}
+		case TableReferenceType::SUBQUERY:
+			VisitQueryNode(*ref.Cast<SubqueryRef>().subquery->node);
+			break;
+		case TableReferenceType::TABLE_FUNCTION:
+			VisitExpression(*ref.Cast<TableFunctionRef>().function);
+			break;
+		case TableReferenceType::PIVOT:
+			VisitTableRef(*ref.Cast<PivotRef>().source);
+			break;
+		default:
+			break;
+		}
+	}
+
+	//! Parameterizes the literal operands of the comparisons in a filter
+	void ParameterizeFilter(ParsedExpression &expr) {
+		switch (expr.GetExpressionClass()) {
+		case ExpressionClass::COMPARISON: {
+			auto &comparison = expr.Cast<ComparisonExpression>();
+			ParameterizeLiteral(comparison.left);
+			ParameterizeLiteral(comparison.right);
+			break;
+		}
+		case ExpressionClass::BETWEEN: {
+			auto &between = expr.Cast<BetweenExpression>();
+			ParameterizeLiteral(between.lower);
+			ParameterizeLiteral(between.upper);
+			break;
+		}
+		case ExpressionClass::OPERATOR: {
+			auto &op = expr.Cast<OperatorExpression>();
+			if (op.type == ExpressionType::COMPARE_IN || op.type == ExpressionType::COMPARE_NOT_IN) {
+				for (idx_t i = 1; i < op.children.size(); i++) {
+					ParameterizeLiteral(op.children[i]);
+				}
+			} else if (op.type == ExpressionType::OPERATOR_NOT) {
+				ParameterizeFilter(*op.children[0]);
+			}
+			break;
+		}
+		case ExpressionClass::CONJUNCTION:
+			for (auto &child : expr.Cast<ConjunctionExpression>().children) {
+				ParameterizeFilter(*child);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	void ParameterizeLiteral(unique_ptr<ParsedExpression> &expr) {
+		if (expr->GetExpressionClass() == ExpressionClass::CAST) {
+			// typed literals (e.g. DATE '1992-01-01') are casts of a string literal
+			auto &cast = expr->Cast<CastExpression>();
+			if (!cast.try_cast) {
+				ParameterizeLiteral(cast.child);
+			}
+			return;
+		}
+		if (expr->GetExpressionClass() != ExpressionClass::CONSTANT) {
+			return;
+		}
+		auto &constant = expr->Cast<ConstantExpression>();
+		if (constant.value.IsNull()) {
+			return;
+		}
+		auto parameter = make_uniq<ParameterExpression>();
+		parameter->identifier = to_string(values.size() + 1);
+		parameter->alias = constant.alias;
+		values[parameter->identifier] = BoundParameterData(std::move(constant.value));
+		expr = std::move(parameter);
+	}
+
+private:
+	case_insensitive_map_t<BoundParameterData> &values;
+};
+
+bool PlanCache::CanUse(ClientContext &context) {
+	if (ClientConfig::GetConfig(context).AnyVerification()) {
+		return false;
+	}
+	// temporary objects shadow the objects of other catalogs, so plans are only shared by clients without them
+	auto &temporary_objects = ClientData::Get(context).temporary_objects;
+	if (!temporary_objects) {
+		return false;
+	}
+	auto temporary_version = temporary_objects->GetCatalog().GetCatalogVersion(context);
+	return temporary_version.IsValid() && temporary_version.GetIndex() == 0;
+}
+
+unique_ptr<SQLStatement> PlanCache::Parameterize(const SQLStatement &statement,
+                                                 case_insensitive_map_t<BoundParameterData> &values) {
+	if (statement.type != StatementType::SELECT_STATEMENT || !statement.named_param_map.empty()) {
+		return nullptr;
+	}
+	auto result = statement.Copy();
+	auto &select = result->Cast<SelectStatement>();
+	LiteralParameterizer parameterizer(values);
+	try {
+		parameterizer.VisitQueryNode(*select.node);
+	} catch (NotImplementedException &) {
+		return nullptr;
+	}
+	for (idx_t i = 0; i < values.size(); i++) {
+		result->named_param_map[to_string(i + 1)] = i + 1;
+	}
+	return result;
+}
+
+static bool SettingAffectsPlan(const string &name) {
+	// these settings only change how the progress of a query is displayed
+	static const char *const DISPLAY_SETTINGS[] = {"enable_progress_bar", "enable_progress_bar_print",
+	                                               "progress_bar_time"};
+	for (auto setting : DISPLAY_SETTINGS) {
+		if (name == setting) {
+			return false;
+		}
+	}
+	return true;
+}
+
+string PlanCache::GetKey(ClientContext &context, const SQLStatement &statement) {
+	string key;
+	try {
+		key = statement.ToString();
+	} catch (NotImplementedException &) {
+		return string();
+	}
+	// the connection-local settings and variables can influence the plan
+	key += "\n" + CatalogSearchEntry::ListToString(ClientData::Get(context).catalog_search_path->Get());
+	for (idx_t i = 0; i < DBConfig::GetOptionCount(); i++) {
+		auto option = DBConfig::GetOptionByIndex(i);
+		if (!option->set_local || !option->get_setting || !SettingAffectsPlan(option->name)) {
+			continue;
+		}
+		key += "\n" + string(option->name) + "=" + option->get_setting(context).ToString();
+	}
+	auto &client_config = ClientConfig::GetConfig(context);
+	for (auto &variables : {&client_config.set_variables, &client_config.user_variables}) {
+		// the maps are unordered, sort the entries for a stable key
+		map<string, string> sorted_variables;
+		for (auto &entry : *variables) {
+			sorted_variables[entry.first] = entry.second.ToSQLString();
+		}
+		for (auto &entry : sorted_variables) {
+			key += "\n" + entry.first + "=" + entry.second;
+		}
+		key += "\n";
+	}
+	return key;
+}
+
+static bool IsCacheablePlan(const PhysicalOperator &op) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		// table functions can depend on state outside of the catalog (e.g. the files matching a glob pattern)
+		auto &name = op.Cast<PhysicalTableScan>().function.name;
+		if (name != "seq_scan" && name != "index_scan") {
+			return false;
+		}
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!IsCacheablePlan(child.get())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PlanCache::IsCacheable(const PreparedStatementData &prepared) {
+	auto &properties = prepared.properties;
+	if (prepared.statement_type != StatementType::SELECT_STATEMENT || !prepared.plan ||
+	    !properties.bound_all_parameters || properties.always_require_rebind || !properties.modified_databases.empty()) {
+		return false;
+	}
+	for (auto &entry : properties.read_databases) {
+		if (!entry.second.catalog_version.IsValid()) {
+			// we cannot check whether the catalog has changed
+			return false;
+		}
+	}
+	for (auto &entry : prepared.value_map) {
+		if (!entry.second->return_type.IsValid()) {
+			// the optimizer requires the values of the parameters, i.e. the plan is only valid for these values
+			return false;
+		}
+	}
+	return IsCacheablePlan(*prepared.plan);
+}
+
+static void CollectReadTables(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto table = op.Cast<LogicalGet>().GetTable();
+		if (table && table->IsDuckTable()) {
+			tables.push_back(table->GetStorage().GetDataTableInfo());
+		}
+	}
+	for (auto &child : op.children) {
+		CollectReadTables(*child, tables);
+	}
+}
+
+vector<weak_ptr<DataTableInfo>> PlanCache::GetReadTables(LogicalOperator &plan) {
+	vector<weak_ptr<DataTableInfo>> result;
+	CollectReadTables(plan, result);
+	return result;
+}
+
+//! Whether or not the transaction of the client sees the latest committed rows of the table (and no others)
+static bool SeesCommittedVersion(ClientContext &context, DataTableInfo &info, transaction_t commit_version) {
+	auto &transaction = DuckTransaction::Get(context, info.GetDB());
+	return commit_version < transaction.start_time && !transaction.ChangesMade();
+}
+
+bool PlanCache::GetTableVersions(ClientContext &context, const PreparedStatementData &prepared,
+                                 vector<PlanCacheTable> &tables) {
+	D_ASSERT(IsCacheablePlan(*prepared.plan));
+	for (auto &table : prepared.read_tables) {
+		auto info = table.lock();
+		if (!info) {
+			return false;
+		}
+		auto commit_version = info->GetCommitVersion();
+		if (!SeesCommittedVersion(context, *info, commit_version)) {
+			return false;
+		}
+		tables.push_back(PlanCacheTable {info, commit_version});
+	}
+	return true;
+}
+
+bool PlanCache::IsValid(ClientContext &context, const vector<PlanCacheTable> &tables) {
+	for (auto &table : tables) {
+		auto info = table.info.lock();
+		if (!info || info->GetCommitVersion() != table.commit_version ||
+		    !SeesCommittedVersion(context, *info, table.commit_version)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool IsExactNumeric(const LogicalType &type) {
+	return type.IsIntegral() || type.id() == LogicalTypeId::DECIMAL;
+}
+
+bool PlanCache::BindValues(const PreparedStatementData &prepared,
+                           case_insensitive_map_t<BoundParameterData> &values) {
+	for (auto &entry : values) {
+		auto parameter = prepared.value_map.find(entry.first);
+		if (parameter == prepared.value_map.end()) {
+			return false;
+		}
+		auto &source_type = entry.second.GetValue().type();
+		auto &target_type = parameter->second->return_type;
+		if (source_type == target_type) {
+			continue;
+		}
+		// a literal takes the type of the expression it is compared with when it is a string literal, or when both
+		// are numeric - other combinations are compared in a common type, which the parameter does not replicate
+		bool compatible = source_type.id() == LogicalTypeId::VARCHAR;
+		if (source_type.IsNumeric() && target_type.IsNumeric()) {
+			compatible = target_type.id() == LogicalTypeId::DOUBLE || IsExactNumeric(target_type) ||
+			             source_type.IsIntegral();
+		}
+		if (!compatible) {
+			return false;
+		}
+		// the cast must not change the value of the literal
+		Value cast_value;
+		Value original_value;
+		if (!entry.second.GetValue().DefaultTryCastAs(target_type, cast_value, nullptr, true) ||
+		    !cast_value.DefaultTryCastAs(source_type, original_value, nullptr, true) ||
+		    !Value::NotDistinctFrom(original_value, entry.second.GetValue())) {
+			return false;
+		}
+		entry.second = BoundParameterData(std::move(cast_value));
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Cache
+//===--------------------------------------------------------------------===//
+bool PlanCache::Enabled() {
+	lock_guard<mutex> guard(lock);
+	return max_entries > 0;
+}
+
+shared_ptr<PreparedStatementData> PlanCache::Take(const string &key, bool &cacheable,
+                                                  vector<PlanCacheTable> &tables) {
+	lock_guard<mutex> guard(lock);
+	cacheable = true;
+	auto entry = plans.find(key);
+	if (entry == plans.end()) {
+		misses++;
+		return nullptr;
+	}
+	if (!entry->second.prepared) {
+		cacheable = false;
+		lru_list.splice(lru_list.begin(), lru_list, entry->second.lru_position);
+		return nullptr;
+	}
+	hits++;
+	auto result = std::move(entry->second.prepared);
+	tables = std::move(entry->second.tables);
+	lru_list.erase(entry->second.lru_position);
+	plans.erase(entry);
+	return result;
+}
+
+static void ResetOperatorStates(const PhysicalOperator &op) {
+	// the global states of the last execution (e.g. hash tables) are not needed by the next one
+	auto &mutable_op = const_cast<PhysicalOperator &>(op);
+	mutable_op.op_state.reset();
+	mutable_op.sink_state.reset();
+	for (auto &child : op.GetChildren()) {
+		ResetOperatorStates(child.get());
+	}
+}
+
+void PlanCache::Put(const string &key, shared_ptr<PreparedStatementData> prepared, vector<PlanCacheTable> tables) {
+	D_ASSERT(prepared && prepared->plan);
+	ResetOperatorStates(*prepared->plan);
+	Insert(key, std::move(prepared), std::move(tables));
+}
+
+void PlanCache::MarkUncacheable(const string &key) {
+	Insert(key, nullptr, vector<PlanCacheTable>());
+}
+
+void PlanCache::Insert(const string &key, shared_ptr<PreparedStatementData> prepared,
+                       vector<PlanCacheTable> tables) {
+	lock_guard<mutex> guard(lock);
+	if (max_entries == 0) {
+		return;
+	}
+	auto entry = plans.find(key);
+	if (entry != plans.end()) {
+		// another query with the same key has put its plan back first - keep that one
+		lru_list.splice(lru_list.begin(), lru_list, entry->second.lru_position);
+		return;
+	}
+	lru_list.push_front(key);
+	plans[key] = CachedPlan {std::move(prepared), std::move(tables), lru_list.begin()};
+	EvictToLimit();
+}
+
+void PlanCache::EvictToLimit() {
+	while (plans.size() > max_entries) {
+		plans.erase(lru_list.back());
+		lru_list.pop_back();
+		evictions++;
+	}
+}
+
+void PlanCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	plans.clear();
+	lru_list.clear();
+}
+
+void PlanCache::SetMaxEntries(idx_t max_entries_p) {
+	lock_guard<mutex> guard(lock);
+	max_entries = max_entries_p;
+	EvictToLimit();
+}
+
+PlanCacheStats PlanCache::GetStats() {
+	lock_guard<mutex> guard(lock);
+	return PlanCacheStats {hits, misses, evictions, plans.size(), max_entries};
+}
+
+} // namespace duckdb
@@ -0,0 +1,211 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+
+namespace duckdb {
+
+bool CheckCatalogIdentity(ClientContext &context, const string &catalog_name,
+                          const StatementProperties::CatalogIdentity catalog_identity);
+
+QueryResultCache::QueryResultCache(idx_t memory_limit_p) : memory_limit(memory_limit_p) {
+}
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetQueryResultCache();
+}
+
+bool QueryResultCache::CanUse(ClientContext &context) {
+	// results are replayed by a single-threaded scan, which only gives the original order when the order is preserved
+	if (!DBConfig::GetConfig(context).options.preserve_insertion_order) {
+		return false;
+	}
+	return PlanCache::CanUse(context);
+}
+
+//! Collects the storage of the tables that are scanned by the plan. Returns false if the plan scans anything else
+//! than tables (e.g. files), whose contents cannot be versioned.
+static bool GetScannedTables(const PhysicalOperator &op, vector<shared_ptr<DataTableInfo>> &tables) {
+	if (op.type == PhysicalOperatorType::TABLE_SCAN) {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (scan.function.name != "seq_scan" && scan.function.name != "index_scan") {
+			return false;
+		}
+		auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+		tables.push_back(bind_data.table.GetStorage().GetDataTableInfo());
+	}
+	for (auto &child : op.GetChildren()) {
+		if (!GetScannedTables(child.get(), tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool QueryResultCache::IsCacheable(const PreparedStatementData &prepared) {
+	if (!PlanCache::IsCacheable(prepared) || prepared.properties.has_volatile_functions) {
+		return false;
+	}
+	vector<shared_ptr<DataTableInfo>> tables;
+	// results that do not read tables are cheap to compute again
+	return GetScannedTables(*prepared.plan, tables) && !tables.empty();
+}
+
+//! Whether or not the transaction of the client sees the latest committed rows of the table (and no others)
+static bool SeesCommittedRows(ClientContext &context, DataTableInfo &info, transaction_t commit_version) {
+	auto &transaction = DuckTransaction::Get(context, info.GetDB());
+	return commit_version < transaction.start_time && !transaction.ChangesMade();
+}
+
+bool QueryResultCache::IsValid(ClientContext &context, const CachedResult &entry) {
+	try {
+		for (auto &database : entry.read_databases) {
+			if (!CheckCatalogIdentity(context, database.first, database.second)) {
+				return false;
+			}
+		}
+	} catch (std::exception &) {
+		// e.g. a database that the statement read from was detached
+		return false;
+	}
+	for (auto &table : entry.tables) {
+		auto info = table.info.lock();
+		if (!info || info->GetCommitVersion() != table.commit_version ||
+		    !SeesCommittedRows(context, *info, table.commit_version)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Cache
+//===--------------------------------------------------------------------===//
+bool QueryResultCache::Enabled() {
+	lock_guard<mutex> guard(lock);
+	return memory_limit > 0;
+}
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Lookup(ClientContext &context, const string &key,
+                                                          vector<string> &names) {
+	CachedResult entry;
+	{
+		lock_guard<mutex> guard(lock);
+		auto result = results.find(key);
+		if (result == results.end()) {
+			misses++;
+			return nullptr;
+		}
+		entry.collection = result->second.collection;
+		entry.names = result->second.names;
+		entry.read_databases = result->second.read_databases;
+		entry.tables = result->second.tables;
+	}
+	// check the versions outside of the lock: this starts transactions in the databases that the statement read
+	if (!IsValid(context, entry)) {
+		// the result is replaced when the statement runs again
+		lock_guard<mutex> guard(lock);
+		misses++;
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	hits++;
+	auto result = results.find(key);
+	if (result != results.end()) {
+		lru_list.splice(lru_list.begin(), lru_list, result->second.lru_position);
+	}
+	names = std::move(entry.names);
+	return std::move(entry.collection);
+}
+
+void QueryResultCache::Put(ClientContext &context, const string &key, const PreparedStatementData &prepared,
+                           ColumnDataCollection &result) {
+	{
+		lock_guard<mutex> guard(lock);
+		if (result.AllocationSize() > memory_limit) {
+			return;
+		}
+	}
+	vector<shared_ptr<DataTableInfo>> tables;
+	if (!GetScannedTables(*prepared.plan, tables)) {
+		return;
+	}
+	CachedResult entry;
+	entry.names = prepared.names;
+	entry.read_databases = prepared.properties.read_databases;
+	for (auto &info : tables) {
+		auto commit_version = info->GetCommitVersion();
+		if (!SeesCommittedRows(context, *info, commit_version)) {
+			// the result does not reflect the latest committed rows of the table
+			return;
+		}
+		entry.tables.push_back(ScannedTable {info, commit_version});
+	}
+	// copy the result into a collection that is managed by the buffer manager
+	entry.collection = make_shared_ptr<ColumnDataCollection>(BufferManager::GetBufferManager(context), result.Types());
+	ColumnDataAppendState append_state;
+	entry.collection->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		entry.collection->Append(append_state, chunk);
+	}
+	entry.memory_usage = entry.collection->AllocationSize();
+
+	lock_guard<mutex> guard(lock);
+	if (entry.memory_usage > memory_limit) {
+		return;
+	}
+	auto existing = results.find(key);
+	if (existing != results.end()) {
+		Erase(existing);
+	}
+	lru_list.push_front(key);
+	entry.lru_position = lru_list.begin();
+	memory_usage += entry.memory_usage;
+	results[key] = std::move(entry);
+	EvictToLimit();
+}
+
+void QueryResultCache::Erase(unordered_map<string, CachedResult>::iterator entry) {
+	memory_usage -= entry->second.memory_usage;
+	lru_list.erase(entry->second.lru_position);
+	results.erase(entry);
+}
+
+void QueryResultCache::EvictToLimit() {
+	while (memory_usage > memory_limit && !lru_list.empty()) {
+		Erase(results.find(lru_list.back()));
+		evictions++;
+	}
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	results.clear();
+	lru_list.clear();
+	memory_usage = 0;
+}
+
+void QueryResultCache::SetMemoryLimit(idx_t memory_limit_p) {
+	lock_guard<mutex> guard(lock);
+	memory_limit = memory_limit_p;
+	EvictToLimit();
+}
+
+QueryResultCacheStats QueryResultCache::GetStats() {
+	lock_guard<mutex> guard(lock);
+	return QueryResultCacheStats {hits, misses, evictions, results.size(), memory_usage, memory_limit};
+}
+
+} // namespace duckdb
@@ -8,12 +8,16 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/plan_cache.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -111,6 +115,32 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Cardinality Feedback Threshold
+//===--------------------------------------------------------------------===//
+void CardinalityFeedbackThresholdSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1) {
+		throw InvalidInputException("cardinality_feedback_threshold must be 0 (disabled) or at least 1");
+	}
+	config.options.cardinality_feedback_threshold = threshold;
+	if (db && threshold == 0) {
+		db->GetCardinalityFeedback().Clear();
+	}
+}
+
+void CardinalityFeedbackThresholdSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.cardinality_feedback_threshold = DBConfig().options.cardinality_feedback_threshold;
+	if (db) {
+		db->GetCardinalityFeedback().Clear();
+	}
+}
+
+Value CardinalityFeedbackThresholdSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.cardinality_feedback_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -446,6 +476,21 @@ Value DisabledOptimizersSetting::GetSetting(const ClientContext &context) {
 	return Value(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Dynamic Or Filter Threshold
+//===--------------------------------------------------------------------===//
+void DynamicOrFilterThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).dynamic_or_filter_threshold = input.GetValue<uint64_t>();
+}
+
+void DynamicOrFilterThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).dynamic_or_filter_threshold = ClientConfig().dynamic_or_filter_threshold;
+}
+
+Value DynamicOrFilterThresholdSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).dynamic_or_filter_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable External Access
 //===--------------------------------------------------------------------===//
@@ -1171,6 +1216,21 @@ Value IntegerDivisionSetting::GetSetting(const ClientContext &context) {
 	return Value(config.integer_division);
 }
 
+//===--------------------------------------------------------------------===//
+// Late Materialization Max Rows
+//===--------------------------------------------------------------------===//
+void LateMaterializationMaxRowsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).late_materialization_max_rows = input.GetValue<uint64_t>();
+}
+
+void LateMaterializationMaxRowsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).late_materialization_max_rows = ClientConfig().late_materialization_max_rows;
+}
+
+Value LateMaterializationMaxRowsSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).late_materialization_max_rows);
+}
+
 //===--------------------------------------------------------------------===//
 // Log Query Path
 //===--------------------------------------------------------------------===//
@@ -1377,6 +1437,31 @@ Value NestedLoopJoinThreshold::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.nested_loop_join_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Object Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void ObjectCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.object_cache_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		db->GetObjectCache().SetMaxMemory(config.options.object_cache_memory_limit);
+	}
+}
+
+void ObjectCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.object_cache_memory_limit = DBConfig().options.object_cache_memory_limit;
+	if (db) {
+		db->GetObjectCache().SetMaxMemory(config.options.object_cache_memory_limit);
+	}
+}
+
+Value ObjectCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	if (config.options.object_cache_memory_limit == DConstants::INVALID_INDEX) {
+		return Value("-1");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.options.object_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
@@ -1559,6 +1644,28 @@ Value PivotLimitSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).pivot_limit));
 }
 
+//===--------------------------------------------------------------------===//
+// Plan Cache Size
+//===--------------------------------------------------------------------===//
+void PlanCacheSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.plan_cache_size = input.GetValue<uint64_t>();
+	if (db) {
+		db->GetPlanCache().SetMaxEntries(config.options.plan_cache_size);
+	}
+}
+
+void PlanCacheSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.plan_cache_size = DBConfig().options.plan_cache_size;
+	if (db) {
+		db->GetPlanCache().SetMaxEntries(config.options.plan_cache_size);
+	}
+}
+
+Value PlanCacheSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.plan_cache_size);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveIdentifierCase
 //===--------------------------------------------------------------------===//
@@ -1761,6 +1868,32 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Result Cache Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryResultCacheMemoryLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto limit = DBConfig::ParseMemoryLimit(input.ToString());
+	if (limit == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("The query result cache requires a memory limit");
+	}
+	config.options.query_result_cache_memory_limit = limit;
+	if (db) {
+		db->GetQueryResultCache().SetMemoryLimit(config.options.query_result_cache_memory_limit);
+	}
+}
+
+void QueryResultCacheMemoryLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_result_cache_memory_limit = DBConfig().options.query_result_cache_memory_limit;
+	if (db) {
+		db->GetQueryResultCache().SetMemoryLimit(config.options.query_result_cache_memory_limit);
+	}
+}
+
+Value QueryResultCacheMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1818,6 +1951,22 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Table Sample Size
+//===--------------------------------------------------------------------===//
+void TableSampleSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.table_sample_size = input.GetValue<uint64_t>();
+}
+
+void TableSampleSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.table_sample_size = DBConfig().options.table_sample_size;
+}
+
+Value TableSampleSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.table_sample_size);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -1845,6 +1994,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,332 @@
+#include "duckdb/optimizer/aggregate_pushdown.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+AggregatePushdown::AggregatePushdown(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> AggregatePushdown::Optimize(unique_ptr<LogicalOperator> op) {
+	OptimizeInternal(op);
+	if (!replacement_bindings.empty()) {
+		// the operators above the rewritten aggregates now read the projections on top of them
+		ColumnBindingReplacer replacer;
+		replacer.replacement_bindings = std::move(replacement_bindings);
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+void AggregatePushdown::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryPushdown(op);
+	}
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+}
+
+static bool IsDecomposable(BoundAggregateExpression &aggregate) {
+	if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys) {
+		return false;
+	}
+	auto &name = aggregate.function.name;
+	if (name == "sum" || name == "min" || name == "max" || name == "count" || name == "count_star") {
+		return true;
+	}
+	if (name == "avg") {
+		// AVG is computed as SUM / COUNT - we only do this for the numeric averages that return a DOUBLE
+		return aggregate.return_type == LogicalType::DOUBLE && aggregate.children.size() == 1 &&
+		       aggregate.children[0]->return_type.IsNumeric();
+	}
+	return false;
+}
+
+static void GetColumnReferences(Expression &expr, vector<ColumnBinding> &bindings, bool &has_correlated_columns) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.depth > 0) {
+			has_correlated_columns = true;
+		}
+		if (std::find(bindings.begin(), bindings.end(), colref.binding) == bindings.end()) {
+			bindings.push_back(colref.binding);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { GetColumnReferences(child, bindings, has_correlated_columns); });
+}
+
+static bool HasBinding(const vector<ColumnBinding> &bindings, const ColumnBinding &binding) {
+	return std::find(bindings.begin(), bindings.end(), binding) != bindings.end();
+}
+
+//! Estimates the number of distinct values of the column, by tracing it back to the statistics of the table
+static bool EstimateDistinctCount(ClientContext &context, LogicalOperator &op, const ColumnBinding &binding,
+                                  idx_t &result) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index != binding.table_index || !get.function.statistics || !get.children.empty()) {
+			return false;
+		}
+		auto column_index =
+		    get.projection_ids.empty() ? binding.column_index : get.projection_ids[binding.column_index];
+		auto column_id = get.GetColumnIds()[column_index];
+		if (IsRowIdColumnId(column_id)) {
+			return false;
+		}
+		auto stats = get.function.statistics(context, get.bind_data.get(), column_id);
+		if (!stats) {
+			return false;
+		}
+		result = stats->GetDistinctCount();
+		return result > 0;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		auto &projection = op.Cast<LogicalProjection>();
+		if (projection.table_index != binding.table_index) {
+			return false;
+		}
+		auto &expr = *projection.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		return EstimateDistinctCount(context, *op.children[0], expr.Cast<BoundColumnRefExpression>().binding, result);
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		// these operators pass on the columns of their children
+		for (auto &child : op.children) {
+			if (EstimateDistinctCount(context, *child, binding, result)) {
+				return true;
+			}
+		}
+		return false;
+	default:
+		return false;
+	}
+}
+
+bool AggregatePushdown::EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &columns, idx_t &result) {
+	auto cardinality = op.EstimateCardinality(optimizer.context);
+	result = 1;
+	for (auto &column : columns) {
+		idx_t distinct_count;
+		if (!EstimateDistinctCount(optimizer.context, op, column, distinct_count)) {
+			return false;
+		}
+		// the distinct counts of the columns are multiplied: there are at most as many groups as rows
+		if (distinct_count >= cardinality / result) {
+			result = cardinality;
+			return true;
+		}
+		result *= distinct_count;
+	}
+	return true;
+}
+
+unique_ptr<BoundAggregateExpression> AggregatePushdown::BindAggregate(const string &name,
+                                                                      unique_ptr<Expression> input) {
+	QueryErrorContext error_context;
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(optimizer.context, SYSTEM_CATALOG, DEFAULT_SCHEMA,
+	                                                              name, error_context);
+	FunctionBinder function_binder(optimizer.context);
+	ErrorData error;
+	auto best_function = function_binder.BindFunction(func.name, func.functions, {input->return_type}, error);
+	if (!best_function.IsValid()) {
+		error.Throw();
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(input));
+	return function_binder.BindAggregateFunction(bound_function, std::move(children), nullptr,
+	                                             AggregateType::NON_DISTINCT);
+}
+
+bool AggregatePushdown::TryPushdown(unique_ptr<LogicalOperator> &op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	// without groups, the aggregate has to return a row (e.g. COUNT(*) = 0) even if the join is empty
+	if (aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty() ||
+	    aggr.expressions.empty()) {
+		return false;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return false;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || !join.left_projection_map.empty() ||
+	    !join.right_projection_map.empty()) {
+		return false;
+	}
+
+	// all aggregates have to be decomposable, and their inputs have to come from the same side of the join
+	vector<ColumnBinding> aggregate_columns;
+	bool has_correlated_columns = false;
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE || expr->IsVolatile()) {
+			return false;
+		}
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (!IsDecomposable(aggregate)) {
+			return false;
+		}
+		for (auto &child : aggregate.children) {
+			GetColumnReferences(*child, aggregate_columns, has_correlated_columns);
+		}
+	}
+	if (has_correlated_columns) {
+		return false;
+	}
+	vector<vector<ColumnBinding>> side_bindings;
+	side_bindings.push_back(join.children[0]->GetColumnBindings());
+	side_bindings.push_back(join.children[1]->GetColumnBindings());
+	idx_t side;
+	if (aggregate_columns.empty()) {
+		// e.g. COUNT(*): pre-aggregate the larger side
+		side = join.children[1]->EstimateCardinality(optimizer.context) >
+		               join.children[0]->EstimateCardinality(optimizer.context)
+		           ? 1
+		           : 0;
+	} else {
+		side = HasBinding(side_bindings[0], aggregate_columns[0]) ? 0 : 1;
+		for (auto &column : aggregate_columns) {
+			if (!HasBinding(side_bindings[side], column)) {
+				return false;
+			}
+		}
+	}
+
+	// the pre-aggregate is grouped by the columns of its side that are used in the join conditions and groups
+	vector<ColumnBinding> all_group_columns;
+	for (auto &cond : join.conditions) {
+		GetColumnReferences(side == 0 ? *cond.left : *cond.right, all_group_columns, has_correlated_columns);
+	}
+	for (auto &group : aggr.groups) {
+		GetColumnReferences(*group, all_group_columns, has_correlated_columns);
+	}
+	vector<ColumnBinding> group_columns;
+	for (auto &column : all_group_columns) {
+		if (HasBinding(side_bindings[side], column)) {
+			group_columns.push_back(column);
+		}
+	}
+	if (has_correlated_columns || group_columns.empty()) {
+		return false;
+	}
+	auto &child = *join.children[side];
+	idx_t group_count;
+	if (!EstimateGroupCount(child, group_columns, group_count) ||
+	    group_count > child.EstimateCardinality(optimizer.context) / MINIMUM_REDUCTION) {
+		// the pre-aggregate does not reduce the input of the join enough to pay off
+		return false;
+	}
+
+	// create the pre-aggregate
+	auto partial_group_index = optimizer.binder.GenerateTableIndex();
+	auto partial_aggregate_index = optimizer.binder.GenerateTableIndex();
+	auto partial = make_uniq<LogicalAggregate>(partial_group_index, partial_aggregate_index,
+	                                           vector<unique_ptr<Expression>>());
+	child.ResolveOperatorTypes();
+	auto child_bindings = child.GetColumnBindings();
+	ColumnBindingReplacer group_replacer;
+	for (auto &column : group_columns) {
+		auto group_binding = ColumnBinding(partial_group_index, partial->groups.size());
+		group_replacer.replacement_bindings.emplace_back(column, group_binding);
+		auto binding_idx = NumericCast<idx_t>(std::find(child_bindings.begin(), child_bindings.end(), column) -
+		                                      child_bindings.begin());
+		partial->groups.push_back(make_uniq<BoundColumnRefExpression>(child.types[binding_idx], column));
+	}
+	for (auto &cond : join.conditions) {
+		auto &expr = side == 0 ? cond.left : cond.right;
+		group_replacer.VisitExpression(&expr);
+	}
+	for (auto &group : aggr.groups) {
+		group_replacer.VisitExpression(&group);
+	}
+
+	// the aggregates above the join combine the pre-aggregated values, a projection finalizes them
+	auto group_index = optimizer.binder.GenerateTableIndex();
+	auto aggregate_index = optimizer.binder.GenerateTableIndex();
+	auto projection_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> aggregates;
+	vector<unique_ptr<Expression>> projections;
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		auto &group = *aggr.groups[group_idx];
+		projections.push_back(
+		    make_uniq<BoundColumnRefExpression>(group.return_type, ColumnBinding(group_index, group_idx)));
+		replacement_bindings.emplace_back(ColumnBinding(aggr.group_index, group_idx),
+		                                  ColumnBinding(projection_index, group_idx));
+	}
+	// combines a pre-aggregated value with the given aggregate function, returns the result of the aggregate
+	auto combine = [&](unique_ptr<Expression> partial_expr, const string &name) -> unique_ptr<Expression> {
+		auto partial_binding = ColumnBinding(partial_aggregate_index, partial->expressions.size());
+		auto partial_ref = make_uniq<BoundColumnRefExpression>(partial_expr->return_type, partial_binding);
+		partial->expressions.push_back(std::move(partial_expr));
+		auto combined = BindAggregate(name, std::move(partial_ref));
+		auto binding = ColumnBinding(aggregate_index, aggregates.size());
+		auto result = make_uniq<BoundColumnRefExpression>(combined->return_type, binding);
+		aggregates.push_back(std::move(combined));
+		return std::move(result);
+	};
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto &aggregate = aggr.expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto &name = aggregate.function.name;
+		unique_ptr<Expression> result;
+		if (name == "avg") {
+			// AVG(x) = SUM(SUM(x)) / SUM(COUNT(x))
+			auto sum = combine(BindAggregate("sum", aggregate.children[0]->Copy()), "sum");
+			auto count = combine(BindAggregate("count", aggregate.children[0]->Copy()), "sum");
+			vector<unique_ptr<Expression>> children;
+			children.push_back(
+			    BoundCastExpression::AddCastToType(optimizer.context, std::move(sum), LogicalType::DOUBLE));
+			children.push_back(
+			    BoundCastExpression::AddCastToType(optimizer.context, std::move(count), LogicalType::DOUBLE));
+			ErrorData error;
+			FunctionBinder function_binder(optimizer.context);
+			result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, "/", std::move(children), error, true);
+			if (!result) {
+				error.Throw();
+			}
+		} else {
+			// SUM(x) = SUM(SUM(x)), COUNT(x) = SUM(COUNT(x)), MIN(x) = MIN(MIN(x)), MAX(x) = MAX(MAX(x))
+			auto combine_name = name == "min" || name == "max" ? name : "sum";
+			result = combine(aggregate.Copy(), combine_name);
+		}
+		// e.g. the SUM of COUNTs is a HUGEINT
+		result = BoundCastExpression::AddCastToType(optimizer.context, std::move(result), aggregate.return_type);
+		replacement_bindings.emplace_back(ColumnBinding(aggr.aggregate_index, aggr_idx),
+		                                  ColumnBinding(projection_index, aggr.groups.size() + aggr_idx));
+		projections.push_back(std::move(result));
+	}
+
+	// plan the pre-aggregate below the join
+	partial->children.push_back(std::move(join.children[side]));
+	partial->SetEstimatedCardinality(group_count);
+	join.children[side] = std::move(partial);
+
+	aggr.group_index = group_index;
+	aggr.aggregate_index = aggregate_index;
+	aggr.expressions = std::move(aggregates);
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(projections));
+	projection->children.push_back(std::move(op));
+	op = std::move(projection);
+	op->ResolveOperatorTypes();
+	return true;
+}
+
+} // namespace duckdb
@@ -0,0 +1,376 @@
+#include "duckdb/optimizer/common_subplan_optimizer.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_cteref.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+
+namespace duckdb {
+
+CommonSubplanOptimizer::SubplanInfo::SubplanInfo(unique_ptr<LogicalOperator> &op_p, string signature_p,
+                                                 idx_t operator_count_p)
+    : op(op_p), signature(std::move(signature_p)), operator_count(operator_count_p) {
+}
+
+CommonSubplanOptimizer::CommonSubplanOptimizer(Optimizer &optimizer_p) : optimizer(optimizer_p) {
+}
+
+static bool CanPlaceMaterializedCTE(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+	case LogicalOperatorType::LOGICAL_WINDOW:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+	case LogicalOperatorType::LOGICAL_TOP_N:
+	case LogicalOperatorType::LOGICAL_LIMIT:
+	case LogicalOperatorType::LOGICAL_DISTINCT:
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static vector<reference<Expression>> GetSubplanExpressions(LogicalOperator &op) {
+	vector<reference<Expression>> result;
+	for (auto &expr : op.expressions) {
+		result.push_back(*expr);
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		for (auto &group : op.Cast<LogicalAggregate>().groups) {
+			result.push_back(*group);
+		}
+	} else if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		for (auto &cond : op.Cast<LogicalComparisonJoin>().conditions) {
+			result.push_back(*cond.left);
+			result.push_back(*cond.right);
+		}
+	}
+	return result;
+}
+
+//! Adds the structure of the expression to the signature, returns false if the expression cannot be shared
+static bool AddExpressionSignature(const Expression &expr, string &signature) {
+	if (expr.IsVolatile()) {
+		return false;
+	}
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF &&
+	    expr.Cast<BoundColumnRefExpression>().depth > 0) {
+		// correlated columns refer to the outer query
+		return false;
+	}
+	bool can_share = true;
+	signature += ExpressionTypeToString(expr.type) + ":" + expr.return_type.ToString() + "(";
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!AddExpressionSignature(child, signature)) {
+			can_share = false;
+		}
+	});
+	signature += ")";
+	return can_share;
+}
+
+static bool ExpressionsAreEqual(const Expression &left, const Expression &right,
+                                const unordered_map<idx_t, idx_t> &table_map) {
+	// rewrite the column references of left to the table indexes of right
+	auto expr = left.Copy();
+	bool all_mapped = true;
+	ExpressionIterator::EnumerateExpression(expr, [&](Expression &child) {
+		if (child.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return;
+		}
+		auto &colref = child.Cast<BoundColumnRefExpression>();
+		auto entry = table_map.find(colref.binding.table_index);
+		if (entry == table_map.end()) {
+			all_mapped = false;
+			return;
+		}
+		colref.binding.table_index = entry->second;
+	});
+	return all_mapped && expr->Equals(right);
+}
+
+static void ClaimOperators(LogicalOperator &op, unordered_set<const LogicalOperator *> &claimed) {
+	claimed.insert(&op);
+	for (auto &child : op.children) {
+		ClaimOperators(*child, claimed);
+	}
+}
+
+bool CommonSubplanOptimizer::CanShareOperator(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		// only scans of tables, which give the same result every time they are read within a query
+		auto &get = op.Cast<LogicalGet>();
+		return get.GetTable() && !get.dynamic_filters && get.children.empty();
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		return true;
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		switch (op.Cast<LogicalComparisonJoin>().join_type) {
+		case JoinType::INNER:
+		case JoinType::LEFT:
+		case JoinType::RIGHT:
+		case JoinType::OUTER:
+		case JoinType::SEMI:
+		case JoinType::ANTI:
+			return true;
+		default:
+			return false;
+		}
+	default:
+		return false;
+	}
+}
+
+bool CommonSubplanOptimizer::SubplansAreEqual(LogicalOperator &left, LogicalOperator &right,
+                                              unordered_map<idx_t, idx_t> &table_map) {
+	if (left.type != right.type || left.children.size() != right.children.size()) {
+		return false;
+	}
+	for (idx_t child_idx = 0; child_idx < left.children.size(); child_idx++) {
+		if (!SubplansAreEqual(*left.children[child_idx], *right.children[child_idx], table_map)) {
+			return false;
+		}
+	}
+	switch (left.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &left_get = left.Cast<LogicalGet>();
+		auto &right_get = right.Cast<LogicalGet>();
+		if (left_get.function.name != right_get.function.name ||
+		    !FunctionData::Equals(left_get.bind_data.get(), right_get.bind_data.get()) ||
+		    left_get.GetColumnIds() != right_get.GetColumnIds() ||
+		    left_get.projection_ids != right_get.projection_ids || left_get.parameters != right_get.parameters ||
+		    !TableFilterSet::Equals(&left_get.table_filters, &right_get.table_filters)) {
+			return false;
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+		if (left.Cast<LogicalFilter>().projection_map != right.Cast<LogicalFilter>().projection_map) {
+			return false;
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		auto &left_aggr = left.Cast<LogicalAggregate>();
+		auto &right_aggr = right.Cast<LogicalAggregate>();
+		if (left_aggr.grouping_sets != right_aggr.grouping_sets ||
+		    left_aggr.grouping_functions != right_aggr.grouping_functions) {
+			return false;
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		auto &left_join = left.Cast<LogicalComparisonJoin>();
+		auto &right_join = right.Cast<LogicalComparisonJoin>();
+		if (left_join.join_type != right_join.join_type ||
+		    left_join.left_projection_map != right_join.left_projection_map ||
+		    left_join.right_projection_map != right_join.right_projection_map ||
+		    left_join.conditions.size() != right_join.conditions.size()) {
+			return false;
+		}
+		for (idx_t cond_idx = 0; cond_idx < left_join.conditions.size(); cond_idx++) {
+			if (left_join.conditions[cond_idx].comparison != right_join.conditions[cond_idx].comparison) {
+				return false;
+			}
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		break;
+	default:
+		return false;
+	}
+
+	// the tables that are introduced by the operators correspond to each other
+	auto left_indexes = left.GetTableIndex();
+	auto right_indexes = right.GetTableIndex();
+	if (left_indexes.size() != right_indexes.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < left_indexes.size(); i++) {
+		table_map[left_indexes[i]] = right_indexes[i];
+	}
+
+	auto left_expressions = GetSubplanExpressions(left);
+	auto right_expressions = GetSubplanExpressions(right);
+	if (left_expressions.size() != right_expressions.size()) {
+		return false;
+	}
+	for (idx_t expr_idx = 0; expr_idx < left_expressions.size(); expr_idx++) {
+		if (!ExpressionsAreEqual(left_expressions[expr_idx], right_expressions[expr_idx], table_map)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CommonSubplanOptimizer::CollectSubplans(unique_ptr<LogicalOperator> &op, string &signature,
+                                             idx_t &operator_count, bool &has_join_or_aggregate) {
+	if (op->type == LogicalOperatorType::LOGICAL_RECURSIVE_CTE) {
+		// the recursive part is evaluated repeatedly, we don't share anything within it
+		return false;
+	}
+	auto can_share = CanShareOperator(*op);
+	signature = LogicalOperatorToString(op->type);
+	operator_count = 1;
+	has_join_or_aggregate = op->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN ||
+	                        op->type == LogicalOperatorType::LOGICAL_CROSS_PRODUCT ||
+	                        op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY;
+	if (can_share) {
+		if (op->type == LogicalOperatorType::LOGICAL_GET) {
+			auto &get = op->Cast<LogicalGet>();
+			signature += "[" + get.GetTable()->name;
+			for (auto &column_id : get.GetColumnIds()) {
+				signature += "," + to_string(column_id);
+			}
+			signature += "]";
+		}
+		for (auto &expr : GetSubplanExpressions(*op)) {
+			if (!AddExpressionSignature(expr, signature)) {
+				can_share = false;
+			}
+		}
+	}
+	signature += "(";
+	for (auto &child : op->children) {
+		string child_signature;
+		idx_t child_operator_count;
+		bool child_has_join_or_aggregate;
+		if (!CollectSubplans(child, child_signature, child_operator_count, child_has_join_or_aggregate)) {
+			can_share = false;
+		}
+		signature += child_signature + ",";
+		operator_count += child_operator_count;
+		has_join_or_aggregate = has_join_or_aggregate || child_has_join_or_aggregate;
+	}
+	signature += ")";
+	// scans and filters are cheaper to compute again than to materialize
+	if (can_share && has_join_or_aggregate) {
+		subplans.emplace_back(op, signature, operator_count);
+	}
+	return can_share;
+}
+
+void CommonSubplanOptimizer::MaterializeSubplan(unique_ptr<LogicalOperator> &root, const vector<idx_t> &occurrences) {
+	auto &binder = optimizer.binder;
+	auto &first = subplans[occurrences[0]].op.get();
+	first->ResolveOperatorTypes();
+	auto types = first->types;
+	if (types.empty()) {
+		return;
+	}
+	vector<string> names;
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		names.push_back("column" + to_string(col_idx));
+	}
+
+	// replace every occurrence with a reference to the CTE, the first occurrence becomes the CTE
+	auto cte_index = binder.GenerateTableIndex();
+	unique_ptr<LogicalOperator> cte_definition;
+	ColumnBindingReplacer replacer;
+	for (auto &subplan_idx : occurrences) {
+		auto &subplan = subplans[subplan_idx].op.get();
+		auto old_bindings = subplan->GetColumnBindings();
+		D_ASSERT(old_bindings.size() == types.size());
+		auto cte_ref = make_uniq<LogicalCTERef>(binder.GenerateTableIndex(), cte_index, types, names,
+		                                        CTEMaterialize::CTE_MATERIALIZE_ALWAYS);
+		for (idx_t col_idx = 0; col_idx < old_bindings.size(); col_idx++) {
+			replacer.replacement_bindings.emplace_back(old_bindings[col_idx],
+			                                           ColumnBinding(cte_ref->table_index, col_idx));
+		}
+		if (!cte_definition) {
+			cte_definition = std::move(subplan);
+		}
+		subplan = std::move(cte_ref);
+	}
+	// the operators above the occurrences now read the columns of the CTE references
+	replacer.VisitOperator(*root);
+
+	root = make_uniq<LogicalMaterializedCTE>("common_subplan_" + to_string(cte_index), cte_index, types.size(),
+	                                         std::move(cte_definition), std::move(root));
+}
+
+unique_ptr<LogicalOperator> CommonSubplanOptimizer::Optimize(unique_ptr<LogicalOperator> op) {
+	// the materialized CTEs are placed on top of the query
+	reference<unique_ptr<LogicalOperator>> root = op;
+	while (root.get()->children.size() == 1 && (root.get()->type == LogicalOperatorType::LOGICAL_EXPLAIN ||
+	                                             root.get()->type == LogicalOperatorType::LOGICAL_INSERT ||
+	                                             root.get()->type == LogicalOperatorType::LOGICAL_CREATE_TABLE)) {
+		root = root.get()->children[0];
+	}
+	if (!CanPlaceMaterializedCTE(*root.get())) {
+		return op;
+	}
+
+	string signature;
+	idx_t operator_count;
+	bool has_join_or_aggregate;
+	CollectSubplans(root.get(), signature, operator_count, has_join_or_aggregate);
+	if (subplans.size() < 2) {
+		return op;
+	}
+
+	// the largest subplans are shared first, the subplans within them are then no longer candidates
+	vector<idx_t> order;
+	unordered_map<string, vector<idx_t>> subplans_by_signature;
+	for (idx_t subplan_idx = 0; subplan_idx < subplans.size(); subplan_idx++) {
+		order.push_back(subplan_idx);
+		subplans_by_signature[subplans[subplan_idx].signature].push_back(subplan_idx);
+	}
+	std::stable_sort(order.begin(), order.end(),
+	                 [&](idx_t a, idx_t b) { return subplans[a].operator_count > subplans[b].operator_count; });
+
+	unordered_set<const LogicalOperator *> claimed;
+	vector<vector<idx_t>> shared_subplans;
+	for (auto &subplan_idx : order) {
+		auto &subplan = *subplans[subplan_idx].op.get();
+		if (claimed.find(&subplan) != claimed.end()) {
+			continue;
+		}
+		vector<idx_t> occurrences {subplan_idx};
+		for (auto &other_idx : subplans_by_signature[subplans[subplan_idx].signature]) {
+			auto &other = *subplans[other_idx].op.get();
+			if (other_idx == subplan_idx || claimed.find(&other) != claimed.end()) {
+				continue;
+			}
+			unordered_map<idx_t, idx_t> table_map;
+			if (SubplansAreEqual(subplan, other, table_map)) {
+				occurrences.push_back(other_idx);
+			}
+		}
+		if (occurrences.size() < 2) {
+			continue;
+		}
+		for (auto &occurrence_idx : occurrences) {
+			ClaimOperators(*subplans[occurrence_idx].op.get(), claimed);
+		}
+		shared_subplans.push_back(std::move(occurrences));
+	}
+
+	for (auto &occurrences : shared_subplans) {
+		MaterializeSubplan(root.get(), occurrences);
+	}
+	return op;
+}
+
+} // namespace duckdb
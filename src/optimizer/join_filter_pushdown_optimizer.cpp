@@ -1,7 +1,12 @@
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_distinct.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_set_operation.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
@@ -56,73 +61,31 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		JoinFilterPushdownColumn pushdown_col;
 		pushdown_col.join_condition = cond_idx;
 
+		// find the scans of the probe side that the filter can be pushed into (if any)
 		auto &colref = cond.left->Cast<BoundColumnRefExpression>();
-		pushdown_col.probe_column_index = colref.binding;
-		pushdown_info->filters.push_back(pushdown_col);
-	}
-	if (pushdown_info->filters.empty()) {
-		// could not generate any filters - bail-out
-		return;
-	}
-	// find the child LogicalGet (if possible)
-	reference<LogicalOperator> probe_source(*join.children[0]);
-	while (probe_source.get().type != LogicalOperatorType::LOGICAL_GET) {
-		auto &probe_child = probe_source.get();
-		switch (probe_child.type) {
-		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
-		case LogicalOperatorType::LOGICAL_TOP_N:
-		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
-		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
-			// does not affect probe side - continue into left child
-			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
-			probe_source = *probe_child.children[0];
-			break;
-		case LogicalOperatorType::LOGICAL_PROJECTION: {
-			// projection - check if we all of the expressions are only column references
-			auto &proj = probe_source.get().Cast<LogicalProjection>();
-			for (auto &filter : pushdown_info->filters) {
-				if (filter.probe_column_index.table_index != proj.table_index) {
-					// index does not belong to this projection - bail-out
-					return;
-				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
-					// not a simple column ref - bail-out
-					return;
-				}
-				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
-				filter.probe_column_index = colref.binding;
+		vector<reference<LogicalGet>> gets;
+		vector<idx_t> column_indexes;
+		GetPushdownTargets(*join.children[0], colref.binding, gets, column_indexes);
+		for (idx_t target_idx = 0; target_idx < gets.size(); target_idx++) {
+			auto &get = gets[target_idx].get();
+			// set up the dynamic filters (if we don't have any yet)
+			if (!get.dynamic_filters) {
+				get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 			}
-			probe_source = *probe_child.children[0];
-			break;
+			JoinFilterPushdownTarget target;
+			target.dynamic_filters = get.dynamic_filters;
+			target.column_index = column_indexes[target_idx];
+			pushdown_col.targets.push_back(std::move(target));
 		}
-		default:
-			// unsupported child type
-			return;
+		if (pushdown_col.targets.empty()) {
+			continue;
 		}
+		pushdown_info->filters.push_back(std::move(pushdown_col));
 	}
-	// found the LogicalGet
-	auto &get = probe_source.get().Cast<LogicalGet>();
-	if (!get.function.filter_pushdown) {
-		// filter pushdown is not supported - bail-out
+	if (pushdown_info->filters.empty()) {
+		// could not generate any filters - bail-out
 		return;
 	}
-	for (auto &filter : pushdown_info->filters) {
-		if (filter.probe_column_index.table_index != get.table_index) {
-			// the filter does not apply to the probe side here - bail-out
-			return;
-		}
-	}
-	// pushdown can be performed
-	// set up the dynamic filters (if we don't have any yet)
-	if (!get.dynamic_filters) {
-		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
-	}
-	pushdown_info->dynamic_filters = get.dynamic_filters;
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
@@ -143,6 +106,172 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 	join.filter_pushdown = std::move(pushdown_info);
 }
 
+static bool HasBinding(LogicalOperator &op, const ColumnBinding &binding) {
+	for (auto &op_binding : op.GetColumnBindings()) {
+		if (op_binding == binding) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool ContainsColumn(const vector<unique_ptr<Expression>> &expressions, const ColumnBinding &binding) {
+	for (auto &expr : expressions) {
+		if (expr->type == ExpressionType::BOUND_COLUMN_REF &&
+		    expr->Cast<BoundColumnRefExpression>().binding == binding) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void JoinFilterPushdownOptimizer::GetPushdownTargets(LogicalOperator &op, const ColumnBinding &binding,
+                                                     vector<reference<LogicalGet>> &gets,
+                                                     vector<idx_t> &column_indexes) {
+	// a join filter only removes rows whose value of the column cannot find a match in the join
+	// we can push it into any operator that passes the values of the column through, and that does not compute
+	// anything else from the rows that it would remove
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		auto &get = op.Cast<LogicalGet>();
+		if (!get.function.filter_pushdown || binding.table_index != get.table_index) {
+			// filter pushdown is not supported - bail-out
+			return;
+		}
+		auto &column_ids = get.GetColumnIds();
+		D_ASSERT(binding.column_index < column_ids.size());
+		if (IsRowIdColumnId(column_ids[binding.column_index])) {
+			return;
+		}
+		for (idx_t target_idx = 0; target_idx < gets.size(); target_idx++) {
+			if (RefersToSameObject(gets[target_idx].get(), get) && column_indexes[target_idx] == binding.column_index) {
+				// we already found this column through another path
+				return;
+			}
+		}
+		gets.push_back(get);
+		column_indexes.push_back(binding.column_index);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_FILTER:
+	case LogicalOperatorType::LOGICAL_ORDER_BY:
+		// does not affect the column - continue into the child
+		// note that we cannot push through limits: they would emit other rows if we remove rows below them
+		GetPushdownTargets(*op.children[0], binding, gets, column_indexes);
+		return;
+	case LogicalOperatorType::LOGICAL_DISTINCT: {
+		// distinct - we can remove entire groups, if the column is one of the distinct targets
+		auto &distinct = op.Cast<LogicalDistinct>();
+		if (!ContainsColumn(distinct.distinct_targets, binding)) {
+			return;
+		}
+		GetPushdownTargets(*op.children[0], binding, gets, column_indexes);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		// projection - check if the expression is a column reference
+		auto &proj = op.Cast<LogicalProjection>();
+		if (binding.table_index != proj.table_index) {
+			return;
+		}
+		auto &expr = *proj.expressions[binding.column_index];
+		if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+			// not a simple column ref - bail-out
+			return;
+		}
+		// column-ref - pass through the new column binding
+		GetPushdownTargets(*op.children[0], expr.Cast<BoundColumnRefExpression>().binding, gets, column_indexes);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+		// aggregate - we can remove entire groups, if the column is a group
+		auto &aggr = op.Cast<LogicalAggregate>();
+		if (binding.table_index != aggr.group_index || aggr.grouping_sets.size() > 1) {
+			return;
+		}
+		auto &group = *aggr.groups[binding.column_index];
+		if (group.type != ExpressionType::BOUND_COLUMN_REF) {
+			return;
+		}
+		GetPushdownTargets(*op.children[0], group.Cast<BoundColumnRefExpression>().binding, gets, column_indexes);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_WINDOW: {
+		// window - we can remove entire partitions, if every window expression is partitioned by the column
+		auto &window = op.Cast<LogicalWindow>();
+		if (binding.table_index == window.window_index) {
+			return;
+		}
+		for (auto &expr : window.expressions) {
+			if (expr->GetExpressionClass() != ExpressionClass::BOUND_WINDOW) {
+				return;
+			}
+			if (!ContainsColumn(expr->Cast<BoundWindowExpression>().partitions, binding)) {
+				return;
+			}
+		}
+		GetPushdownTargets(*op.children[0], binding, gets, column_indexes);
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT: {
+		// set operation - push into the corresponding column of every child
+		auto &setop = op.Cast<LogicalSetOperation>();
+		if (binding.table_index != setop.table_index) {
+			return;
+		}
+		for (auto &child : op.children) {
+			auto child_bindings = child->GetColumnBindings();
+			if (child_bindings.size() != setop.column_count) {
+				return;
+			}
+			GetPushdownTargets(*child, child_bindings[binding.column_index], gets, column_indexes);
+		}
+		return;
+	}
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+		// join - continue into the child that the column comes from
+		// rows that lose their join partner can only become NULL-padded, and are then still removed by the filter
+		for (auto &child : op.children) {
+			if (HasBinding(*child, binding)) {
+				GetPushdownTargets(*child, binding, gets, column_indexes);
+			}
+		}
+		if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+			return;
+		}
+		auto &join = op.Cast<LogicalComparisonJoin>();
+		if (join.join_type != JoinType::INNER && join.join_type != JoinType::SEMI &&
+		    join.join_type != JoinType::RIGHT_SEMI) {
+			return;
+		}
+		// the join only emits rows for which the columns of its equality conditions are equal
+		// transfer the filter to the column on the other side, so it also removes rows there
+		for (auto &cond : join.conditions) {
+			if (cond.comparison != ExpressionType::COMPARE_EQUAL ||
+			    cond.left->type != ExpressionType::BOUND_COLUMN_REF ||
+			    cond.right->type != ExpressionType::BOUND_COLUMN_REF) {
+				continue;
+			}
+			auto &left_binding = cond.left->Cast<BoundColumnRefExpression>().binding;
+			auto &right_binding = cond.right->Cast<BoundColumnRefExpression>().binding;
+			if (left_binding == binding) {
+				GetPushdownTargets(*join.children[1], right_binding, gets, column_indexes);
+			} else if (right_binding == binding) {
+				GetPushdownTargets(*join.children[0], left_binding, gets, column_indexes);
+			}
+		}
+		return;
+	}
+	default:
+		// unsupported operator type
+		// FIXME: we can probably recurse into more operators here (e.g. unnest)
+		return;
+	}
+}
+
 void JoinFilterPushdownOptimizer::VisitOperator(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
 		// comparison join - try to generate join filters (if possible)
@@ -4,6 +4,7 @@
 #include "duckdb/common/printer.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
@@ -370,6 +371,22 @@ DenomInfo CardinalityEstimator::GetDenominator(JoinRelationSet &set) {
 	return DenomInfo(*subgraphs.at(0).numerator_relations, 1, subgraphs.at(0).denom);
 }
 
+bool CardinalityEstimator::TryGetObservedCardinality(JoinRelationSet &set, idx_t &result) {
+	if (!cardinality_feedback || set.count < 2) {
+		// the observed cardinalities of single relations are applied to their relation stats
+		return false;
+	}
+	vector<string> relation_keys;
+	for (idx_t i = 0; i < set.count; i++) {
+		auto entry = relation_feedback_keys.find(set.relations[i]);
+		if (entry == relation_feedback_keys.end()) {
+			return false;
+		}
+		relation_keys.push_back(entry->second);
+	}
+	return cardinality_feedback->TryGetCardinality(CardinalityFeedback::GetKey(std::move(relation_keys)), result);
+}
+
 template <>
 double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set) {
 
@@ -377,11 +394,16 @@ double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set
 		return relation_set_2_cardinality[new_set.ToString()].cardinality_before_filters;
 	}
 
-	// can happen if a table has cardinality 0, or a tdom is set to 0
-	auto denom = GetDenominator(new_set);
-	auto numerator = GetNumerator(denom.numerator_relations);
-
-	double result = numerator / denom.denominator;
+	double result;
+	idx_t observed_cardinality;
+	if (TryGetObservedCardinality(new_set, observed_cardinality)) {
+		result = static_cast<double>(observed_cardinality);
+	} else {
+		// can happen if a table has cardinality 0, or a tdom is set to 0
+		auto denom = GetDenominator(new_set);
+		auto numerator = GetNumerator(denom.numerator_relations);
+		result = numerator / denom.denominator;
+	}
 	auto new_entry = CardinalityHelper(result);
 	relation_set_2_cardinality[new_set.ToString()] = new_entry;
 	return result;
@@ -417,6 +439,9 @@ void CardinalityEstimator::InitCardinalityEstimatorProps(optional_ptr<JoinRelati
 
 	auto card_helper = CardinalityHelper((double)relation_cardinality);
 	relation_set_2_cardinality[set->ToString()] = card_helper;
+	if (!stats.feedback_key.empty()) {
+		relation_feedback_keys[set->relations[0]] = stats.feedback_key;
+	}
 
 	UpdateTotalDomains(set, stats);
 
@@ -424,6 +449,10 @@ void CardinalityEstimator::InitCardinalityEstimatorProps(optional_ptr<JoinRelati
 	std::sort(relations_to_tdoms.begin(), relations_to_tdoms.end(), SortTdoms);
 }
 
+void CardinalityEstimator::SetCardinalityFeedback(CardinalityFeedback &feedback) {
+	cardinality_feedback = &feedback;
+}
+
 void CardinalityEstimator::UpdateTotalDomains(optional_ptr<JoinRelationSet> set, RelationStats &stats) {
 	D_ASSERT(set->count == 1);
 	auto relation_id = set->relations[0];
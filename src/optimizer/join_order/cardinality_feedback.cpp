@@ -0,0 +1,151 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback::CardinalityFeedback() : version(0) {
+}
+
+CardinalityFeedback &CardinalityFeedback::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetCardinalityFeedback();
+}
+
+bool CardinalityFeedback::Enabled(ClientContext &context) {
+	return DBConfig::GetConfig(context).options.cardinality_feedback_threshold > 0;
+}
+
+static void AppendOperatorKey(ClientContext &context, LogicalOperator &op, string &result) {
+	if (op.type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		// projections do not change the cardinality, and they are added and removed by the optimizers
+		AppendOperatorKey(context, *op.children[0], result);
+		return;
+	}
+	result += op.GetName();
+	result += "(";
+	for (auto &entry : op.ParamsToString()) {
+		auto value = entry.second;
+		if (op.type == LogicalOperatorType::LOGICAL_GET && entry.first == "Filters") {
+			// the table filters are not ordered: the same filters can be listed in any order
+			auto filters = StringUtil::Split(value, "\n");
+			std::sort(filters.begin(), filters.end());
+			value = StringUtil::Join(filters, "\n");
+		}
+		result += entry.first + "=" + value + ";";
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		// the observed cardinality is only used as long as the number of rows of the scanned table stays the same
+		auto &get = op.Cast<LogicalGet>();
+		if (get.function.cardinality) {
+			auto node_stats = get.function.cardinality(context, get.bind_data.get());
+			if (node_stats && node_stats->has_estimated_cardinality) {
+				result += "rows=" + to_string(node_stats->estimated_cardinality) + ";";
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		AppendOperatorKey(context, *child, result);
+	}
+	result += ")";
+}
+
+string CardinalityFeedback::GetRelationKey(ClientContext &context, LogicalOperator &op) {
+	string result;
+	AppendOperatorKey(context, op, result);
+	return result;
+}
+
+string CardinalityFeedback::GetKey(vector<string> relation_keys) {
+	// the join order optimizer can join the relations in any order
+	std::sort(relation_keys.begin(), relation_keys.end());
+	string result;
+	for (auto &relation_key : relation_keys) {
+		if (relation_key.empty()) {
+			return string();
+		}
+		result += relation_key;
+		result += "\n";
+	}
+	return result;
+}
+
+static bool IsReorderableJoin(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_CROSS_PRODUCT) {
+		return true;
+	}
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return op.Cast<LogicalComparisonJoin>().join_type == JoinType::INNER;
+	}
+	return false;
+}
+
+void CardinalityFeedback::CollectRelationKeys(ClientContext &context, LogicalOperator &op,
+                                              vector<string> &relation_keys) {
+	// mirror how the relation manager splits a join tree into the relations of the join order optimizer
+	optional_ptr<LogicalOperator> child = &op;
+	while (child->type == LogicalOperatorType::LOGICAL_FILTER ||
+	       child->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		child = child->children[0].get();
+	}
+	if (!IsReorderableJoin(*child)) {
+		relation_keys.push_back(GetRelationKey(context, op));
+		return;
+	}
+	for (auto &join_child : child->children) {
+		CollectRelationKeys(context, *join_child, relation_keys);
+	}
+}
+
+string CardinalityFeedback::GetKey(ClientContext &context, LogicalOperator &op) {
+	vector<string> relation_keys;
+	CollectRelationKeys(context, op, relation_keys);
+	return GetKey(std::move(relation_keys));
+}
+
+void CardinalityFeedback::Record(ClientContext &context, const string &key, idx_t estimated_cardinality,
+                                 idx_t cardinality) {
+	auto threshold = DBConfig::GetConfig(context).options.cardinality_feedback_threshold;
+	if (key.empty() || threshold <= 0) {
+		return;
+	}
+	auto estimate = MaxValue<double>(static_cast<double>(estimated_cardinality), 1);
+	auto actual = MaxValue<double>(static_cast<double>(cardinality), 1);
+	if (actual < estimate * threshold && estimate < actual * threshold) {
+		// the estimate was good enough
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (cardinalities.size() >= MAX_ENTRIES && cardinalities.find(key) == cardinalities.end()) {
+		cardinalities.erase(cardinalities.begin());
+	}
+	cardinalities[key] = cardinality;
+	version++;
+}
+
+bool CardinalityFeedback::TryGetCardinality(const string &key, idx_t &result) {
+	if (key.empty()) {
+		return false;
+	}
+	lock_guard<mutex> guard(lock);
+	auto entry = cardinalities.find(key);
+	if (entry == cardinalities.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
+void CardinalityFeedback::Clear() {
+	lock_guard<mutex> guard(lock);
+	cardinalities.clear();
+	version++;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
 
@@ -450,6 +451,9 @@ void PlanEnumerator::InitLeafPlans() {
 	// first initialize equivalent relations based on the filters
 	auto relation_stats = query_graph_manager.relation_manager.GetRelationStats();
 
+	if (CardinalityFeedback::Enabled(query_graph_manager.context)) {
+		cost_model.cardinality_estimator.SetCardinalityFeedback(CardinalityFeedback::Get(query_graph_manager.context));
+	}
 	cost_model.cardinality_estimator.InitEquivalentRelations(query_graph_manager.GetFilterBindings());
 	cost_model.cardinality_estimator.AddRelationNamesToTdoms(relation_stats);
 
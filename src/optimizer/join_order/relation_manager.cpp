@@ -2,6 +2,7 @@
 
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
 #include "duckdb/parser/expression_map.hpp"
@@ -27,9 +28,23 @@ idx_t RelationManager::NumRelations() {
 	return relations.size();
 }
 
+void RelationManager::ApplyCardinalityFeedback(LogicalOperator &op, RelationStats &stats) {
+	if (!CardinalityFeedback::Enabled(context)) {
+		return;
+	}
+	stats.feedback_key = CardinalityFeedback::GetRelationKey(context, op);
+	idx_t observed_cardinality;
+	if (CardinalityFeedback::Get(context).TryGetCardinality(CardinalityFeedback::GetKey({stats.feedback_key}),
+	                                                        observed_cardinality)) {
+		// a previous query has observed the cardinality of this relation
+		stats.cardinality = observed_cardinality;
+	}
+}
+
 void RelationManager::AddAggregateOrWindowRelation(LogicalOperator &op, optional_ptr<LogicalOperator> parent,
                                                    const RelationStats &stats, LogicalOperatorType op_type) {
 	auto relation = make_uniq<SingleJoinRelation>(op, parent, stats);
+	ApplyCardinalityFeedback(op, relation->stats);
 	auto relation_id = relations.size();
 
 	auto op_bindings = op.GetColumnBindings();
@@ -38,9 +53,9 @@ void RelationManager::AddAggregateOrWindowRelation(LogicalOperator &op, optional
 			relation_mapping[binding.table_index] = relation_id;
 		}
 	}
-	relations.push_back(std::move(relation));
-	op.estimated_cardinality = stats.cardinality;
+	op.estimated_cardinality = relation->stats.cardinality;
 	op.has_estimated_cardinality = true;
+	relations.push_back(std::move(relation));
 }
 
 void RelationManager::AddRelation(LogicalOperator &op, optional_ptr<LogicalOperator> parent,
@@ -50,6 +65,7 @@ void RelationManager::AddRelation(LogicalOperator &op, optional_ptr<LogicalOpera
 	// if parent is not null, it should have multiple children
 	D_ASSERT(!parent || parent->children.size() >= 2);
 	auto relation = make_uniq<SingleJoinRelation>(op, parent, stats);
+	ApplyCardinalityFeedback(op, relation->stats);
 	auto relation_id = relations.size();
 
 	auto table_indexes = op.GetTableIndex();
@@ -71,9 +87,9 @@ void RelationManager::AddRelation(LogicalOperator &op, optional_ptr<LogicalOpera
 		D_ASSERT(relation_mapping.find(table_index) == relation_mapping.end());
 		relation_mapping[table_index] = relation_id;
 	}
-	relations.push_back(std::move(relation));
-	op.estimated_cardinality = stats.cardinality;
+	op.estimated_cardinality = relation->stats.cardinality;
 	op.has_estimated_cardinality = true;
+	relations.push_back(std::move(relation));
 }
 
 bool RelationManager::CrossProductWithRelationAllowed(idx_t relation_id) {
@@ -329,8 +345,14 @@ bool RelationManager::ExtractJoinRelations(JoinOrderOptimizer &optimizer, Logica
 		// table scan, apply another selectivity.
 		get.SetEstimatedCardinality(stats.cardinality);
 		if (!datasource_filters.empty()) {
-			stats.cardinality =
-			    (idx_t)MaxValue(double(stats.cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY, (double)1);
+			auto sample_cardinality =
+			    RelationStatisticsHelper::EstimateCardinalityWithSample(get, context, datasource_filters);
+			if (sample_cardinality.IsValid()) {
+				stats.cardinality = MinValue(sample_cardinality.GetIndex(), stats.cardinality);
+			} else {
+				stats.cardinality = (idx_t)MaxValue(
+				    double(stats.cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY, (double)1);
+			}
 		}
 		ModifyStatsIfLimit(limit_op.get(), stats);
 		AddRelation(input_op, parent, stats);
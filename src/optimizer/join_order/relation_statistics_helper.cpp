@@ -8,6 +8,8 @@
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/storage/statistics/value_distribution.hpp"
 
 namespace duckdb {
 
@@ -104,7 +106,21 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		}
 	}
 
+	auto sample_cardinality = optional_idx();
+	auto distribution_cardinality = optional_idx();
 	if (!get.table_filters.filters.empty()) {
+		sample_cardinality = EstimateCardinalityWithSample(get, context, {});
+		if (!sample_cardinality.IsValid()) {
+			distribution_cardinality = EstimateCardinalityWithDistributions(get, context, base_table_cardinality);
+		}
+	}
+	if (sample_cardinality.IsValid()) {
+		// the filters were evaluated on a sample of the table - this also captures correlations between the filters
+		cardinality_after_filters = MinValue(sample_cardinality.GetIndex(), base_table_cardinality);
+	} else if (distribution_cardinality.IsValid()) {
+		// the filters were evaluated on the value distributions of the columns computed by ANALYZE
+		cardinality_after_filters = MinValue(distribution_cardinality.GetIndex(), base_table_cardinality);
+	} else if (!get.table_filters.filters.empty()) {
 		column_statistics = nullptr;
 		for (auto &it : get.table_filters.filters) {
 			if (get.bind_data && get.function.statistics) {
@@ -140,6 +156,250 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 	return return_stats;
 }
 
+static bool TryEstimateSelectivity(const ValueDistribution &distribution, const TableFilter &filter,
+                                   idx_t distinct_count, double &result) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &comparison = filter.Cast<ConstantFilter>();
+		auto &constant = comparison.constant;
+		switch (comparison.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			result = distribution.EqualSelectivity(constant, distinct_count);
+			return true;
+		case ExpressionType::COMPARE_NOTEQUAL:
+			result = MaxValue<double>(
+			    1 - distribution.null_fraction - distribution.EqualSelectivity(constant, distinct_count), 0);
+			return true;
+		case ExpressionType::COMPARE_LESSTHAN:
+			result = distribution.RangeSelectivity(Value(), false, constant, false);
+			return true;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			result = distribution.RangeSelectivity(Value(), false, constant, true);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			result = distribution.RangeSelectivity(constant, false, Value(), false);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			result = distribution.RangeSelectivity(constant, true, Value(), false);
+			return true;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::IS_NULL:
+		result = distribution.null_fraction;
+		return true;
+	case TableFilterType::IS_NOT_NULL:
+		result = 1 - distribution.null_fraction;
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		// the bounds on the column are combined into a single range: they are not independent
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		Value lower, upper;
+		bool lower_inclusive = false, upper_inclusive = false, has_range = false;
+		double other_selectivity = 1;
+		for (auto &child : conjunction.child_filters) {
+			if (child->filter_type == TableFilterType::CONSTANT_COMPARISON) {
+				auto &comparison = child->Cast<ConstantFilter>();
+				auto &constant = comparison.constant;
+				auto type = comparison.comparison_type;
+				if (type == ExpressionType::COMPARE_GREATERTHAN || type == ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
+					auto inclusive = type == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+					if (lower.IsNull() || lower < constant || (lower == constant && !inclusive)) {
+						lower = constant;
+						lower_inclusive = inclusive;
+					}
+					has_range = true;
+					continue;
+				}
+				if (type == ExpressionType::COMPARE_LESSTHAN || type == ExpressionType::COMPARE_LESSTHANOREQUALTO) {
+					auto inclusive = type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+					if (upper.IsNull() || constant < upper || (upper == constant && !inclusive)) {
+						upper = constant;
+						upper_inclusive = inclusive;
+					}
+					has_range = true;
+					continue;
+				}
+			}
+			double child_selectivity;
+			if (!TryEstimateSelectivity(distribution, *child, distinct_count, child_selectivity)) {
+				return false;
+			}
+			other_selectivity *= child_selectivity;
+		}
+		result = other_selectivity;
+		if (has_range) {
+			result *= distribution.RangeSelectivity(lower, lower_inclusive, upper, upper_inclusive);
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
+		result = 0;
+		for (auto &child : conjunction.child_filters) {
+			double child_selectivity;
+			if (!TryEstimateSelectivity(distribution, *child, distinct_count, child_selectivity)) {
+				return false;
+			}
+			result += child_selectivity;
+		}
+		result = MinValue<double>(result, 1);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+optional_idx RelationStatisticsHelper::EstimateCardinalityWithDistributions(LogicalGet &get, ClientContext &context,
+                                                                            idx_t base_table_cardinality) {
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return optional_idx();
+	}
+	auto &columns = table->GetColumns();
+	auto &storage = table->GetStorage();
+	bool has_distribution = false;
+	double selectivity = 1;
+	for (auto &entry : get.table_filters.filters) {
+		double filter_selectivity = DEFAULT_SELECTIVITY;
+		if (!IsRowIdColumnId(entry.first) && entry.first < columns.LogicalColumnCount()) {
+			auto &column = columns.GetColumn(LogicalIndex(entry.first));
+			auto distribution = column.Generated() ? nullptr : storage.GetValueDistribution(column.Physical().index);
+			if (distribution) {
+				idx_t distinct_count = 0;
+				auto column_stats = storage.GetStatistics(context, column.Physical().index);
+				if (column_stats) {
+					distinct_count = column_stats->GetDistinctCount();
+				}
+				double distribution_selectivity;
+				if (TryEstimateSelectivity(*distribution, *entry.second, distinct_count, distribution_selectivity)) {
+					filter_selectivity = distribution_selectivity;
+					has_distribution = true;
+				}
+			}
+		}
+		// the filters on different columns are assumed to be independent
+		selectivity *= filter_selectivity;
+	}
+	if (!has_distribution) {
+		return optional_idx();
+	}
+	if (base_table_cardinality == 0) {
+		return 0;
+	}
+	return MaxValue<idx_t>(LossyNumericCast<idx_t>(static_cast<double>(base_table_cardinality) * selectivity), 1);
+}
+
+//! Replaces the column references to the columns of the scan with references to the columns of the table sample
+static bool BindToTableSample(unique_ptr<Expression> &expr, LogicalGet &get, const ColumnList &columns) {
+	switch (expr->GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF: {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		auto &column_ids = get.GetColumnIds();
+		if (colref.binding.table_index != get.table_index || colref.binding.column_index >= column_ids.size()) {
+			return false;
+		}
+		auto column_id = column_ids[colref.binding.column_index];
+		if (IsRowIdColumnId(column_id) || column_id >= columns.LogicalColumnCount()) {
+			return false;
+		}
+		auto &column = columns.GetColumn(LogicalIndex(column_id));
+		if (column.Generated()) {
+			return false;
+		}
+		expr = make_uniq<BoundReferenceExpression>(column.Type(), column.Physical().index);
+		return true;
+	}
+	case ExpressionClass::BOUND_PARAMETER:
+	case ExpressionClass::BOUND_SUBQUERY:
+	case ExpressionClass::BOUND_REF:
+		// the value of these expressions is not known while optimizing
+		return false;
+	default:
+		break;
+	}
+	bool success = true;
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		if (success) {
+			success = BindToTableSample(child, get, columns);
+		}
+	});
+	return success;
+}
+
+optional_idx RelationStatisticsHelper::EstimateCardinalityWithSample(LogicalGet &get, ClientContext &context,
+                                                                     const vector<reference<LogicalOperator>> &filters) {
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return optional_idx();
+	}
+	auto sample = table->GetStorage().GetTableSample();
+	if (!sample) {
+		return optional_idx();
+	}
+	auto &columns = table->GetColumns();
+	if (sample->ColumnCount() != columns.PhysicalColumnCount()) {
+		return optional_idx();
+	}
+
+	// collect the filters as a conjunction over the columns of the sample
+	auto conjunction = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
+	for (auto &entry : get.table_filters.filters) {
+		if (IsRowIdColumnId(entry.first) || entry.first >= columns.LogicalColumnCount()) {
+			return optional_idx();
+		}
+		auto &column = columns.GetColumn(LogicalIndex(entry.first));
+		BoundReferenceExpression column_ref(column.Type(), column.Physical().index);
+		conjunction->children.push_back(entry.second->ToExpression(column_ref));
+	}
+	for (auto &filter : filters) {
+		if (filter.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			return optional_idx();
+		}
+		for (auto &expr : filter.get().expressions) {
+			auto sample_expr = expr->Copy();
+			if (!BindToTableSample(sample_expr, get, columns)) {
+				return optional_idx();
+			}
+			conjunction->children.push_back(std::move(sample_expr));
+		}
+	}
+	if (conjunction->children.empty()) {
+		return optional_idx();
+	}
+
+	// count the sample rows that pass the filters
+	idx_t sample_count = sample->size();
+	idx_t selected_count = 0;
+	try {
+		ExpressionExecutor executor(context, *conjunction);
+		SelectionVector slice_sel(STANDARD_VECTOR_SIZE);
+		SelectionVector result_sel(STANDARD_VECTOR_SIZE);
+		for (idx_t offset = 0; offset < sample_count; offset += STANDARD_VECTOR_SIZE) {
+			auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, sample_count - offset);
+			for (idx_t i = 0; i < count; i++) {
+				slice_sel.set_index(i, offset + i);
+			}
+			DataChunk slice;
+			slice.InitializeEmpty(sample->GetTypes());
+			slice.Slice(*sample, slice_sel, count);
+			selected_count += executor.SelectExpression(slice, result_sel);
+		}
+	} catch (std::exception &) {
+		// e.g. a cast in the filter fails on one of the sample rows
+		return optional_idx();
+	}
+
+	auto cardinality = double(get.EstimateCardinality(context));
+	if (selected_count == 0) {
+		// no sample row passes the filters: the selectivity is (much) smaller than one in the sample size
+		return MaxValue<idx_t>(LossyNumericCast<idx_t>(cardinality / double(sample_count + 1)), 1);
+	}
+	return MaxValue<idx_t>(LossyNumericCast<idx_t>(cardinality * double(selected_count) / double(sample_count)), 1);
+}
+
 RelationStats RelationStatisticsHelper::ExtractDelimGetStats(LogicalDelimGet &delim_get, ClientContext &context) {
 	RelationStats stats;
 	stats.table_name = delim_get.GetName();
@@ -0,0 +1,217 @@
+#include "duckdb/optimizer/late_materialization.hpp"
+
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+LateMaterialization::LateMaterialization(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+static void InlineProjection(unique_ptr<Expression> &expr, LogicalProjection &projection) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index == projection.table_index && colref.depth == 0) {
+			expr = projection.expressions[colref.binding.column_index]->Copy();
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr,
+	                                      [&](unique_ptr<Expression> &child) { InlineProjection(child, projection); });
+}
+
+bool LateMaterialization::CollectColumns(Expression &expr, idx_t table_index, const vector<column_t> &column_ids,
+                                         idx_t narrow_table_index, vector<column_t> &narrow_column_ids,
+                                         column_binding_map_t<ColumnBinding> &binding_map) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != table_index || colref.depth > 0) {
+			return false;
+		}
+		if (binding_map.find(colref.binding) == binding_map.end()) {
+			narrow_column_ids.push_back(column_ids[colref.binding.column_index]);
+			binding_map[colref.binding] = ColumnBinding(narrow_table_index, narrow_column_ids.size() - 1);
+		}
+		return true;
+	}
+	bool success = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		if (!CollectColumns(child, table_index, column_ids, narrow_table_index, narrow_column_ids, binding_map)) {
+			success = false;
+		}
+	});
+	return success;
+}
+
+void LateMaterialization::ReplaceBindings(Expression &expr, const column_binding_map_t<ColumnBinding> &binding_map) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		colref.binding = binding_map.find(colref.binding)->second;
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { ReplaceBindings(child, binding_map); });
+}
+
+static bool HasColumnsToFetch(LogicalGet &get, const vector<column_t> &narrow_column_ids) {
+	auto &column_ids = get.GetColumnIds();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		if (!get.projection_ids.empty() &&
+		    std::find(get.projection_ids.begin(), get.projection_ids.end(), i) == get.projection_ids.end()) {
+			// the column is only read for the table filters
+			continue;
+		}
+		if (!IsRowIdColumnId(column_ids[i]) &&
+		    std::find(narrow_column_ids.begin(), narrow_column_ids.end(), column_ids[i]) == narrow_column_ids.end()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool LateMaterialization::TryLateMaterialization(unique_ptr<LogicalOperator> &op) {
+	auto &top_n = op->Cast<LogicalTopN>();
+	auto max_rows = ClientConfig::GetConfig(optimizer.context).late_materialization_max_rows;
+	if (top_n.limit > max_rows || top_n.offset > max_rows - top_n.limit) {
+		// fetching rows one by one is only cheaper than scanning the columns for a few rows
+		return false;
+	}
+	// find the scan below the Top-N: we can look through a projection and a filter
+	optional_ptr<LogicalProjection> projection;
+	optional_ptr<LogicalFilter> filter;
+	reference<LogicalOperator> child = *top_n.children[0];
+	if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projection = child.get().Cast<LogicalProjection>();
+		child = *child.get().children[0];
+	}
+	if (child.get().type == LogicalOperatorType::LOGICAL_FILTER) {
+		filter = child.get().Cast<LogicalFilter>();
+		if (!filter->projection_map.empty()) {
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.GetTable() || !get.children.empty() || get.dynamic_filters ||
+	    !get.projected_input.empty()) {
+		// we can only fetch rows by row id from base tables
+		return false;
+	}
+
+	// express the orders in the columns of the scan
+	vector<BoundOrderByNode> orders;
+	for (auto &order : top_n.orders) {
+		auto expr = order.expression->Copy();
+		if (projection) {
+			InlineProjection(expr, *projection);
+		}
+		if (expr->IsVolatile()) {
+			// the projection computes the expression again for the result
+			return false;
+		}
+		orders.emplace_back(order.type, order.null_order, std::move(expr));
+	}
+	// the columns that the scan reads - the fetch reads them as well, so the bindings of the scan remain valid
+	auto column_ids = get.GetColumnIds();
+	// the narrow scan only reads the columns that the Top-N and the filter need, and the row ids
+	auto narrow_table_index = optimizer.binder.GenerateTableIndex();
+	vector<column_t> narrow_column_ids;
+	column_binding_map_t<ColumnBinding> binding_map;
+	for (auto &order : orders) {
+		if (!CollectColumns(*order.expression, get.table_index, column_ids, narrow_table_index, narrow_column_ids,
+		                    binding_map)) {
+			return false;
+		}
+	}
+	if (filter) {
+		for (auto &expr : filter->expressions) {
+			if (!CollectColumns(*expr, get.table_index, column_ids, narrow_table_index, narrow_column_ids,
+			                    binding_map)) {
+				return false;
+			}
+		}
+	}
+	for (auto &table_filter : get.table_filters.filters) {
+		if (std::find(narrow_column_ids.begin(), narrow_column_ids.end(), table_filter.first) ==
+		    narrow_column_ids.end()) {
+			narrow_column_ids.push_back(table_filter.first);
+		}
+	}
+	if (!HasColumnsToFetch(get, narrow_column_ids)) {
+		// the narrow scan already reads all columns that the scan emits
+		return false;
+	}
+	idx_t row_id_index;
+	auto row_id_entry = std::find(narrow_column_ids.begin(), narrow_column_ids.end(), COLUMN_IDENTIFIER_ROW_ID);
+	if (row_id_entry == narrow_column_ids.end()) {
+		row_id_index = narrow_column_ids.size();
+		narrow_column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	} else {
+		row_id_index = NumericCast<idx_t>(row_id_entry - narrow_column_ids.begin());
+	}
+
+	// turn the scan into the narrow scan
+	auto &table = get.bind_data->Cast<TableScanBindData>().table;
+	auto table_index = get.table_index;
+	get.table_index = narrow_table_index;
+	get.SetColumnIds(std::move(narrow_column_ids));
+	get.projection_ids.clear();
+	if (filter) {
+		for (auto &expr : filter->expressions) {
+			ReplaceBindings(*expr, binding_map);
+		}
+	}
+	for (auto &order : orders) {
+		ReplaceBindings(*order.expression, binding_map);
+	}
+	top_n.orders = std::move(orders);
+
+	// move the Top-N below the projection
+	unique_ptr<LogicalOperator> projection_op;
+	if (projection) {
+		projection_op = std::move(top_n.children[0]);
+		top_n.children[0] = std::move(projection_op->children[0]);
+	}
+	vector<unique_ptr<Expression>> row_ids;
+	row_ids.push_back(make_uniq<BoundColumnRefExpression>("rowid", LogicalType::ROW_TYPE,
+	                                                      ColumnBinding(narrow_table_index, row_id_index)));
+	auto row_id_projection = make_uniq<LogicalProjection>(optimizer.binder.GenerateTableIndex(), std::move(row_ids));
+	row_id_projection->children.push_back(std::move(op));
+
+	// fetch the columns of the original scan (with its table index) for the rows of the Top-N
+	auto fetch = make_uniq<LogicalGet>(table_index, TableScanFunction::GetRowIdFetchFunction(),
+	                                   make_uniq<TableScanBindData>(table), get.returned_types, get.names);
+	fetch->SetColumnIds(std::move(column_ids));
+	fetch->input_table_types.push_back(LogicalType::ROW_TYPE);
+	fetch->input_table_names.emplace_back("rowid");
+	fetch->children.push_back(std::move(row_id_projection));
+	if (projection_op) {
+		projection_op->children[0] = std::move(fetch);
+		op = std::move(projection_op);
+	} else {
+		op = std::move(fetch);
+	}
+	return true;
+}
+
+unique_ptr<LogicalOperator> LateMaterialization::Optimize(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_TOP_N && TryLateMaterialization(op)) {
+		return op;
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -10,7 +10,7 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperat
 	D_ASSERT(op->type == LogicalOperatorType::LOGICAL_GET);
 	auto &get = op->Cast<LogicalGet>();
 
-	if (get.function.pushdown_complex_filter || get.function.filter_pushdown) {
+	if (!optimizer.generic_plan && (get.function.pushdown_complex_filter || get.function.filter_pushdown)) {
 		// this scan supports some form of filter push-down
 		// check if there are any parameters
 		// if there are, invalidate them to force a re-bind on execution
@@ -26,6 +26,9 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	if (view_query) {
+		result->view_query = unique_ptr_cast<SQLStatement, SelectStatement>(view_query->Copy());
+	}
 	return std::move(result);
 }
 
@@ -39,14 +42,16 @@ string CreateTableInfo::ToString() const {
 	if (temporary) {
 		ret += " TEMP";
 	}
-	ret += " TABLE ";
+	ret += view_query ? " MATERIALIZED VIEW " : " TABLE ";
 
 	if (on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
 		ret += " IF NOT EXISTS ";
 	}
 	ret += QualifierToString(temporary ? "" : catalog, schema, table);
 
-	if (query != nullptr) {
+	if (view_query != nullptr) {
+		ret += " AS " + view_query->ToString();
+	} else if (query != nullptr) {
 		ret += " AS " + query->ToString();
 	} else {
 		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
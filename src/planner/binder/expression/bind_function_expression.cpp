@@ -135,6 +135,8 @@ BindResult ExpressionBinder::BindFunction(FunctionExpression &function, ScalarFu
 		auto &bound_function = result->Cast<BoundFunctionExpression>();
 		if (bound_function.function.stability == FunctionStability::CONSISTENT_WITHIN_QUERY) {
 			binder.SetAlwaysRequireRebind();
+		} else if (bound_function.function.stability == FunctionStability::VOLATILE) {
+			binder.GetStatementProperties().has_volatile_functions = true;
 		}
 	}
 	return BindResult(std::move(result));
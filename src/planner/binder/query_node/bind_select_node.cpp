@@ -4,6 +4,7 @@
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/parser/expression/columnref_expression.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/parser/expression/conjunction_expression.hpp"
@@ -362,6 +363,10 @@ void Binder::BindModifiers(BoundQueryNode &result, idx_t table_index, const vect
 
 unique_ptr<BoundQueryNode> Binder::BindNode(SelectNode &statement) {
 	D_ASSERT(statement.from_table);
+	if (mode == BindingMode::STANDARD_BINDING && !entry_retriever.GetCallback()) {
+		// answer the query from a materialized view with the same query (if there is one)
+		MaterializedView::TryRewrite(*this, statement);
+	}
 
 	// first bind the FROM table statement
 	auto from = std::move(statement.from_table);
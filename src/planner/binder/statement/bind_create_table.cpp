@@ -10,6 +10,7 @@
 #include "duckdb/catalog/catalog_entry/type_catalog_entry.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/common/string.hpp"
@@ -297,6 +298,14 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableCheckpoint(unique_ptr<Cr
                                                                    SchemaCatalogEntry &schema) {
 	auto result = make_uniq<BoundCreateTableInfo>(schema, std::move(info));
 	CreateColumnDependencyManager(*result);
+	auto &base = result->Base();
+	if (base.view_query) {
+		if (base.dependencies.Set().empty()) {
+			// older storage versions do not store dependencies: restore the dependency on the table of the view
+			base.dependencies = MaterializedView::GetDependencies(*base.view_query, schema);
+		}
+		result->dependencies = base.dependencies;
+	}
 	return result;
 }
 
@@ -308,9 +317,27 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
 	if (base.query) {
+		if (base.view_query) {
+			// a materialized view depends on the table that it reads
+			SetCatalogLookupCallback([&dependencies, &schema](CatalogEntry &entry) {
+				if (&schema.ParentCatalog() != &entry.ParentCatalog()) {
+					return;
+				}
+				dependencies.AddDependency(entry);
+			});
+			MaterializedView::AddCountColumn(*base.query);
+		}
 		// construct the result object
 		auto query_obj = Bind(*base.query);
 		base.query.reset();
+		if (base.view_query) {
+			auto &table = MaterializedView::VerifyQuery(*query_obj.plan);
+			if (&table.ParentCatalog() != &schema.ParentCatalog()) {
+				throw BinderException("A materialized view must be created in the catalog of the table that it reads");
+			}
+			// keep the dependencies in the info of the view, so they are restored when the database is loaded
+			base.dependencies = dependencies;
+		}
 		result->query = std::move(query_obj.plan);
 
 		// construct the set of columns based on the names and types of the query
@@ -464,6 +464,9 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 
 	BindSchemaOrCatalog(stmt.catalog, stmt.schema);
 	auto &table = Catalog::GetEntry<TableCatalogEntry>(context, stmt.catalog, stmt.schema, stmt.table);
+	if (table.IsMaterializedView()) {
+		throw BinderException("Cannot insert into materialized view \"%s\"", table.name);
+	}
 	if (!table.temporary) {
 		// inserting into a non-temporary table: alters underlying database
 		auto &properties = GetStatementProperties();
@@ -76,6 +76,9 @@ BoundStatement Binder::Bind(UpdateStatement &stmt) {
 	}
 	auto &table_binding = bound_table->Cast<BoundBaseTableRef>();
 	auto &table = table_binding.table;
+	if (table.IsMaterializedView()) {
+		throw BinderException("Cannot update materialized view \"%s\"", table.name);
+	}
 
 	// Add CTEs as bindable
 	AddCTEMap(stmt.cte_map);
@@ -4,6 +4,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/parser/query_node/select_node.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/parser/tableref/basetableref.hpp"
@@ -229,6 +230,10 @@ unique_ptr<BoundTableRef> Binder::Bind(BaseTableRef &ref) {
 		vector<LogicalType> return_types;
 		vector<string> return_names;
 		for (auto &col : table.GetColumns().Logical()) {
+			if (MaterializedView::IsCountColumn(table, col)) {
+				// the hidden count column is the last column of the view: it is only used to maintain the view
+				continue;
+			}
 			table_types.push_back(col.Type());
 			table_names.push_back(col.Name());
 			return_types.push_back(col.Type());
@@ -41,7 +41,8 @@ typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
 public:
-	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0) {
+	explicit EvictionQueue(bool frequency_aware_p)
+	    : frequency_aware(frequency_aware_p), evict_queue_insertions(0), total_dead_nodes(0) {
 	}
 
 public:
@@ -50,6 +51,9 @@ public:
 	bool AddToEvictionQueue(BufferEvictionNode &&node);
 	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
 	bool TryDequeueWithLock(BufferEvictionNode &node);
+	//! Gives a frequently accessed block a second chance, i.e., re-enqueues it instead of evicting it.
+	//! Must be called while holding the block lock. Returns true, if the node was re-enqueued.
+	bool TrySecondChance(BufferEvictionNode &node, BlockHandle &handle);
 	//! Garbage collect dead nodes in the eviction queue.
 	void Purge();
 	template <typename FN>
@@ -71,6 +75,10 @@ private:
 public:
 	//! The concurrent queue
 	eviction_queue_t q;
+	//! Whether blocks that were pinned repeatedly while loaded get extra passes through the queue before eviction.
+	//! This makes the queue scan-resistant: blocks touched only once (e.g., by a large sequential scan) are evicted
+	//! before blocks that are re-used frequently (e.g., small dimension tables or indexes).
+	const bool frequency_aware;
 
 private:
 	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
@@ -108,6 +116,16 @@ bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
 	return q.try_dequeue(node);
 }
 
+bool EvictionQueue::TrySecondChance(BufferEvictionNode &node, BlockHandle &handle) {
+	if (!frequency_aware || handle.access_frequency == 0) {
+		return false;
+	}
+	// every pass through the queue costs one unit of frequency, so eviction always makes progress eventually
+	handle.access_frequency--;
+	q.enqueue(std::move(node));
+	return true;
+}
+
 void EvictionQueue::Purge() {
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
@@ -199,7 +217,9 @@ BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
 	queues.reserve(FILE_BUFFER_TYPE_COUNT);
 	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
-		queues.push_back(make_uniq<EvictionQueue>());
+		// persistent table data is frequency-aware, so that large scans do not flush frequently re-used blocks
+		auto type = FileBufferType(i + 1);
+		queues.push_back(make_uniq<EvictionQueue>(type == FileBufferType::BLOCK));
 	}
 }
 BufferPool::~BufferPool() {
@@ -286,7 +306,12 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
-	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+	queue.IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
+		if (queue.TrySecondChance(node, *handle)) {
+			// the block was re-used recently, try to evict other blocks first
+			return true;
+		}
+
 		// hooray, we can unload the block
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
@@ -55,8 +55,11 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 	// this is where the row groups for this table start
 	auto pointer = table_data_writer.GetMetaBlockPointer();
 
-	// Serialize statistics as a single unit
-	BinarySerializer stats_serializer(table_data_writer);
+	// Serialize statistics as a single unit, in the format of the storage version of the database
+	SerializationOptions stats_options;
+	stats_options.serialization_compatibility =
+	    checkpoint_manager.db.GetDatabase().config.options.serialization_compatibility;
+	BinarySerializer stats_serializer(table_data_writer, stats_options);
 	stats_serializer.Begin();
 	global_stats.Serialize(stats_serializer);
 	stats_serializer.End();
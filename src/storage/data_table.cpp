@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      commit_version(0), vacuum_count(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -374,7 +375,7 @@ TableStorageInfo DataTable::GetStorageInfo() {
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
-void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vector<column_t> &column_ids,
+void DataTable::Fetch(TransactionData transaction, DataChunk &result, const vector<column_t> &column_ids,
                       const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
 	auto lock = info->checkpoint_lock.GetSharedLock();
 	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
@@ -1173,6 +1174,7 @@ idx_t DataTable::Delete(TableDeleteState &state, ClientContext &context, Vector
 
 	auto &transaction = DuckTransaction::Get(context, db);
 	auto &local_storage = LocalStorage::Get(transaction);
+	transaction.ModifyTable(*this);
 
 	row_identifiers.Flatten(count);
 	auto ids = FlatVector::GetData<row_t>(row_identifiers);
@@ -1332,6 +1334,7 @@ void DataTable::Update(TableUpdateState &state, ClientContext &context, Vector &
 
 	// first verify that no constraints are violated
 	VerifyUpdateConstraints(*state.constraint_state, context, updates, column_ids);
+	DuckTransaction::Get(context, db).ModifyTable(*this);
 
 	// now perform the actual update
 	Vector max_row_id_vec(Value::BIGINT(MAX_ROW_ID));
@@ -1382,6 +1385,7 @@ void DataTable::UpdateColumn(TableCatalogEntry &table, ClientContext &context, V
 
 	// now perform the actual update
 	auto &transaction = DuckTransaction::Get(context, db);
+	transaction.ModifyTable(*this);
 
 	updates.Flatten();
 	row_ids.Flatten(updates.size());
@@ -1398,11 +1402,29 @@ unique_ptr<BaseStatistics> DataTable::GetStatistics(ClientContext &context, colu
 	return row_groups->CopyStats(column_id);
 }
 
+unique_ptr<DataChunk> DataTable::GetTableSample() {
+	return row_groups->GetTableStatistics().GetTableSample();
+}
+
+unique_ptr<ValueDistribution> DataTable::GetValueDistribution(column_t column_id) {
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	return row_groups->GetTableStatistics().CopyValueDistribution(column_id);
+}
+
 void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats) {
 	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+void DataTable::SetValueDistribution(column_t column_id, unique_ptr<ValueDistribution> distribution) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetValueDistribution(column_id, std::move(distribution));
+	// the distributions are not written to the WAL: make sure that the next checkpoint persists them
+	StorageManager::Get(db).SetStatisticsChanged();
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -1415,11 +1437,23 @@ unique_ptr<StorageLockKey> DataTable::GetCheckpointLock() {
 }
 
 void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
+	auto sample_size = DBConfig::GetConfig(db.GetDatabase()).options.table_sample_size;
+	bool rows_changed = sample_size > 0 && !row_groups->IsPersistent();
+
 	// checkpoint each individual row group
 	TableStatistics global_stats;
 	row_groups->CopyStats(global_stats);
 	row_groups->Checkpoint(writer, global_stats);
 
+	// sample the rows of the table if they have changed since the last sample
+	auto &table_stats = row_groups->GetTableStatistics();
+	if (sample_size == 0) {
+		table_stats.SetTableSample(nullptr);
+	} else if (rows_changed || !table_stats.HasTableSample(sample_size)) {
+		table_stats.SetTableSample(row_groups->SampleRows(sample_size));
+	}
+	table_stats.CopyTableSample(global_stats);
+
 	// The row group payload data has been written. Now write:
 	//   column stats
 	//   row-group pointers
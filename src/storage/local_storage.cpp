@@ -258,6 +258,15 @@ bool LocalTableManager::IsEmpty() {
 	return table_storage.empty();
 }
 
+vector<reference<DataTable>> LocalTableManager::GetTables() {
+	lock_guard<mutex> l(table_storage_lock);
+	vector<reference<DataTable>> result;
+	for (auto &entry : table_storage) {
+		result.push_back(entry.first);
+	}
+	return result;
+}
+
 shared_ptr<LocalTableStorage> LocalTableManager::MoveEntry(DataTable &table) {
 	lock_guard<mutex> l(table_storage_lock);
 	auto entry = table_storage.find(table);
@@ -407,6 +416,10 @@ bool LocalStorage::Find(DataTable &table) {
 	return table_manager.GetStorage(table) != nullptr;
 }
 
+vector<reference<DataTable>> LocalStorage::GetTables() {
+	return table_manager.GetTables();
+}
+
 idx_t LocalStorage::EstimatedSize() {
 	return table_manager.EstimatedSize();
 }
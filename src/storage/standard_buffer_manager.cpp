@@ -314,6 +314,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
 			handle->readers++;
+			handle->IncrementAccessFrequency();
 			buf = handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
@@ -45,6 +45,21 @@ void ColumnStatistics::SetDistinct(unique_ptr<DistinctStatistics> distinct) {
 	this->distinct_stats = std::move(distinct);
 }
 
+bool ColumnStatistics::HasValueDistribution() {
+	return distribution.get();
+}
+
+ValueDistribution &ColumnStatistics::GetValueDistribution() {
+	if (!distribution) {
+		throw InternalException("GetValueDistribution called without a value distribution");
+	}
+	return *distribution;
+}
+
+void ColumnStatistics::SetValueDistribution(unique_ptr<ValueDistribution> distribution_p) {
+	this->distribution = std::move(distribution_p);
+}
+
 void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 	if (!distinct_stats) {
 		return;
@@ -54,19 +69,30 @@ void ColumnStatistics::UpdateDistinctStatistics(Vector &v, idx_t count) {
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Copy() const {
-	return make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	auto result = make_shared_ptr<ColumnStatistics>(stats.Copy(), distinct_stats ? distinct_stats->Copy() : nullptr);
+	if (distribution) {
+		result->distribution = distribution->Copy();
+	}
+	return result;
 }
 
 void ColumnStatistics::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty(100, "statistics", stats);
 	serializer.WritePropertyWithDefault(101, "distinct", distinct_stats, unique_ptr<DistinctStatistics>());
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(102, "distribution", distribution, unique_ptr<ValueDistribution>());
+	}
 }
 
 shared_ptr<ColumnStatistics> ColumnStatistics::Deserialize(Deserializer &deserializer) {
 	auto stats = deserializer.ReadProperty<BaseStatistics>(100, "statistics");
 	auto distinct_stats = deserializer.ReadPropertyWithExplicitDefault<unique_ptr<DistinctStatistics>>(
 	    101, "distinct", unique_ptr<DistinctStatistics>());
-	return make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	auto distribution = deserializer.ReadPropertyWithExplicitDefault<unique_ptr<ValueDistribution>>(
+	    102, "distribution", unique_ptr<ValueDistribution>());
+	auto result = make_shared_ptr<ColumnStatistics>(std::move(stats), std::move(distinct_stats));
+	result->distribution = std::move(distribution);
+	return result;
 }
 
 } // namespace duckdb
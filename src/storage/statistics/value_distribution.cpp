@@ -0,0 +1,216 @@
+#include "duckdb/storage/statistics/value_distribution.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+ValueDistribution::ValueDistribution() : null_fraction(0), histogram_fraction(0), histogram_distinct_count(0) {
+}
+
+bool ValueDistribution::TypeIsSupported(const LogicalType &type) {
+	return !type.IsNested();
+}
+
+static bool ValueLessThan(const Value &a, const Value &b) {
+	return a < b;
+}
+
+unique_ptr<ValueDistribution> ValueDistribution::Create(Vector &sample, idx_t count) {
+	if (count == 0) {
+		return nullptr;
+	}
+	vector<Value> values;
+	for (idx_t i = 0; i < count; i++) {
+		auto value = sample.GetValue(i);
+		if (!value.IsNull()) {
+			values.push_back(std::move(value));
+		}
+	}
+	auto result = make_uniq<ValueDistribution>();
+	result->null_fraction = static_cast<double>(count - values.size()) / static_cast<double>(count);
+	if (values.empty()) {
+		return result;
+	}
+	std::sort(values.begin(), values.end(), ValueLessThan);
+
+	// find the runs of equal values
+	vector<pair<idx_t, idx_t>> runs;
+	for (idx_t start = 0; start < values.size();) {
+		idx_t end = start + 1;
+		while (end < values.size() && values[end] == values[start]) {
+			end++;
+		}
+		runs.emplace_back(start, end - start);
+		start = end;
+	}
+
+	// the most common values are the values that occur clearly more often than the average value
+	// if the sample has few distinct values, all of them are kept
+	vector<idx_t> run_order;
+	for (idx_t i = 0; i < runs.size(); i++) {
+		run_order.push_back(i);
+	}
+	std::stable_sort(run_order.begin(), run_order.end(),
+	                 [&](idx_t a, idx_t b) { return runs[a].second > runs[b].second; });
+	auto keep_all = runs.size() <= MAX_MOST_COMMON_VALUES;
+	auto average_count = static_cast<double>(values.size()) / static_cast<double>(runs.size());
+	vector<bool> is_common(runs.size(), false);
+	for (auto run_idx : run_order) {
+		auto run_count = runs[run_idx].second;
+		if (result->most_common_values.size() >= MAX_MOST_COMMON_VALUES) {
+			break;
+		}
+		if (!keep_all && (run_count < 2 || static_cast<double>(run_count) < average_count * 1.25)) {
+			break;
+		}
+		is_common[run_idx] = true;
+		result->most_common_values.push_back(values[runs[run_idx].first]);
+		result->most_common_frequencies.push_back(static_cast<double>(run_count) / static_cast<double>(count));
+	}
+
+	// the other values go in the histogram
+	vector<idx_t> others;
+	for (idx_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+		if (is_common[run_idx]) {
+			continue;
+		}
+		result->histogram_distinct_count++;
+		for (idx_t i = 0; i < runs[run_idx].second; i++) {
+			others.push_back(runs[run_idx].first + i);
+		}
+	}
+	result->histogram_fraction = static_cast<double>(others.size()) / static_cast<double>(count);
+	if (others.size() == 1) {
+		result->histogram_bounds.push_back(values[others[0]]);
+	} else if (others.size() > 1) {
+		auto bucket_count = MinValue<idx_t>(MAX_HISTOGRAM_BUCKETS, others.size() - 1);
+		for (idx_t i = 0; i <= bucket_count; i++) {
+			auto position = i * (others.size() - 1) / bucket_count;
+			result->histogram_bounds.push_back(values[others[position]]);
+		}
+	}
+	return result;
+}
+
+static bool TryGetDouble(const Value &value, double &result) {
+	if (!value.type().IsNumeric()) {
+		return false;
+	}
+	Value double_value;
+	string error;
+	if (!value.DefaultTryCastAs(LogicalType::DOUBLE, double_value, &error)) {
+		return false;
+	}
+	result = double_value.GetValue<double>();
+	return true;
+}
+
+double ValueDistribution::HistogramFractionBelow(const Value &value) const {
+	if (histogram_bounds.empty() || value < histogram_bounds.front()) {
+		return 0;
+	}
+	if (!(value < histogram_bounds.back())) {
+		return 1;
+	}
+	// find the bucket of the value: bounds[bucket] <= value < bounds[bucket + 1]
+	auto entry = std::upper_bound(histogram_bounds.begin(), histogram_bounds.end(), value, ValueLessThan);
+	auto bucket = NumericCast<idx_t>(entry - histogram_bounds.begin()) - 1;
+	// interpolate within the bucket for numeric values, otherwise assume the middle of the bucket
+	double position_in_bucket = 0.5;
+	double lower, upper, target;
+	if (TryGetDouble(histogram_bounds[bucket], lower) && TryGetDouble(histogram_bounds[bucket + 1], upper) &&
+	    TryGetDouble(value, target) && upper > lower) {
+		position_in_bucket = (target - lower) / (upper - lower);
+	}
+	return (static_cast<double>(bucket) + position_in_bucket) / static_cast<double>(histogram_bounds.size() - 1);
+}
+
+double ValueDistribution::EqualSelectivity(const Value &value, idx_t distinct_count) const {
+	for (idx_t i = 0; i < most_common_values.size(); i++) {
+		if (most_common_values[i] == value) {
+			return most_common_frequencies[i];
+		}
+	}
+	if (histogram_distinct_count == 0) {
+		// all values of the sample are common values
+		return 0;
+	}
+	// the other values are assumed to be equally common
+	auto other_distinct_count = distinct_count > most_common_values.size() ? distinct_count - most_common_values.size()
+	                                                                         : idx_t(1);
+	other_distinct_count = MaxValue(other_distinct_count, histogram_distinct_count);
+	return histogram_fraction / static_cast<double>(other_distinct_count);
+}
+
+double ValueDistribution::RangeSelectivity(const Value &lower, bool lower_inclusive, const Value &upper,
+                                           bool upper_inclusive) const {
+	double result = 0;
+	for (idx_t i = 0; i < most_common_values.size(); i++) {
+		auto &value = most_common_values[i];
+		if (!lower.IsNull() && (lower_inclusive ? value < lower : value <= lower)) {
+			continue;
+		}
+		if (!upper.IsNull() && (upper_inclusive ? upper < value : upper <= value)) {
+			continue;
+		}
+		result += most_common_frequencies[i];
+	}
+	if (!histogram_bounds.empty()) {
+		auto below_upper = upper.IsNull() ? 1 : HistogramFractionBelow(upper);
+		auto below_lower = lower.IsNull() ? 0 : HistogramFractionBelow(lower);
+		result += histogram_fraction * MaxValue<double>(below_upper - below_lower, 0);
+	}
+	return MinValue<double>(result, 1);
+}
+
+unique_ptr<ValueDistribution> ValueDistribution::Copy() const {
+	auto result = make_uniq<ValueDistribution>();
+	result->null_fraction = null_fraction;
+	result->most_common_values = most_common_values;
+	result->most_common_frequencies = most_common_frequencies;
+	result->histogram_fraction = histogram_fraction;
+	result->histogram_bounds = histogram_bounds;
+	result->histogram_distinct_count = histogram_distinct_count;
+	return result;
+}
+
+string ValueDistribution::ToString() const {
+	string result = StringUtil::Format("[Null Fraction: %.4f][Most Common Values:", null_fraction);
+	for (idx_t i = 0; i < most_common_values.size(); i++) {
+		result += StringUtil::Format(" %s (%.4f)", most_common_values[i].ToString(), most_common_frequencies[i]);
+	}
+	result += "][Histogram Bounds:";
+	for (auto &bound : histogram_bounds) {
+		result += " " + bound.ToString();
+	}
+	return result + "]";
+}
+
+void ValueDistribution::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "null_fraction", null_fraction);
+	serializer.WritePropertyWithDefault<vector<Value>>(101, "most_common_values", most_common_values);
+	serializer.WritePropertyWithDefault<vector<double>>(102, "most_common_frequencies", most_common_frequencies);
+	serializer.WriteProperty(103, "histogram_fraction", histogram_fraction);
+	serializer.WritePropertyWithDefault<vector<Value>>(104, "histogram_bounds", histogram_bounds);
+	serializer.WritePropertyWithDefault<idx_t>(105, "histogram_distinct_count", histogram_distinct_count);
+}
+
+unique_ptr<ValueDistribution> ValueDistribution::Deserialize(Deserializer &deserializer) {
+	auto result = make_uniq<ValueDistribution>();
+	deserializer.ReadProperty(100, "null_fraction", result->null_fraction);
+	deserializer.ReadPropertyWithDefault<vector<Value>>(101, "most_common_values", result->most_common_values);
+	deserializer.ReadPropertyWithDefault<vector<double>>(102, "most_common_frequencies",
+	                                                     result->most_common_frequencies);
+	deserializer.ReadProperty(103, "histogram_fraction", result->histogram_fraction);
+	deserializer.ReadPropertyWithDefault<vector<Value>>(104, "histogram_bounds", result->histogram_bounds);
+	deserializer.ReadPropertyWithDefault<idx_t>(105, "histogram_distinct_count", result->histogram_distinct_count);
+	if (result->most_common_values.size() != result->most_common_frequencies.size()) {
+		throw SerializationException("Value distribution has a different number of most common values and frequencies");
+	}
+	return result;
+}
+
+} // namespace duckdb
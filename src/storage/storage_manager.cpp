@@ -358,11 +358,14 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 		db.GetStorageExtension()->OnCheckpointStart(db, options);
 	}
 	auto &config = DBConfig::Get(db);
-	if (GetWALSize() > 0 || config.options.force_checkpoint || options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
-		// we only need to checkpoint if there is anything in the WAL
+	if (GetWALSize() > 0 || statistics_changed || config.options.force_checkpoint ||
+	    options.action == CheckpointAction::ALWAYS_CHECKPOINT) {
+		// we only need to checkpoint if there is anything in the WAL, or if statistics changed
 		try {
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
+			// the changed statistics are only written once the checkpoint succeeded
+			statistics_changed = false;
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
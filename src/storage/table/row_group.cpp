@@ -985,8 +985,12 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 }
 
 bool RowGroup::IsPersistent() const {
-	for (auto &column : columns) {
-		if (!column->IsPersistent()) {
+	for (idx_t c = 0; c < columns.size(); c++) {
+		if (is_loaded && !is_loaded[c]) {
+			// the column has not been loaded from disk yet
+			continue;
+		}
+		if (!columns[c]->IsPersistent()) {
 			// column is not persistent
 			return false;
 		}
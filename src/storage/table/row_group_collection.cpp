@@ -16,6 +16,7 @@
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -740,9 +741,17 @@ private:
 //===--------------------------------------------------------------------===//
 struct VacuumState {
 	bool can_vacuum_deletes = false;
+	//! Whether or not vacuuming has changed the row ids of any rows
+	bool row_ids_changed = false;
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! Whether or not the entries of the moved rows in the indexes of the table must be updated
+	bool update_indexes = false;
+	//! For every segment that was merged from other row groups: the row ids that its rows had before the merge
+	vector<unsafe_vector<row_t>> previous_row_ids;
+	//! For every segment that was moved without being merged: the row start that it had before
+	vector<idx_t> previous_row_start;
 };
 
 class VacuumTask : public BaseCheckpointTask {
@@ -772,13 +781,23 @@ public:
 			start += current_row_group_rows;
 		}
 
-		DataChunk scan_chunk;
-		scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
-
 		vector<column_t> column_ids;
 		for (idx_t c = 0; c < types.size(); c++) {
 			column_ids.push_back(c);
 		}
+		auto scan_types = types;
+		// if the table has indexes we also scan the row ids, so the index entries of the merged rows can be moved
+		unsafe_vector<row_t> previous_row_ids;
+		if (vacuum_state.update_indexes) {
+			column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+			scan_types.push_back(LogicalType::ROW_TYPE);
+			previous_row_ids.reserve(merge_rows);
+		}
+
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(Allocator::DefaultAllocator(), scan_types);
+		DataChunk append_chunk;
+		append_chunk.InitializeEmpty(types);
 
 		idx_t current_append_idx = 0;
 
@@ -809,11 +828,21 @@ public:
 				if (scan_chunk.size() == 0) {
 					break;
 				}
-				idx_t remaining = scan_chunk.size();
+				if (vacuum_state.update_indexes) {
+					auto &row_ids = scan_chunk.data[types.size()];
+					row_ids.Flatten(scan_chunk.size());
+					auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+					previous_row_ids.insert(previous_row_ids.end(), row_id_data, row_id_data + scan_chunk.size());
+				}
+				for (idx_t c = 0; c < types.size(); c++) {
+					append_chunk.data[c].Reference(scan_chunk.data[c]);
+				}
+				append_chunk.SetCardinality(scan_chunk);
+				idx_t remaining = append_chunk.size();
 				while (remaining > 0) {
 					idx_t append_count =
 					    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
-					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, scan_chunk,
+					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, append_chunk,
 					                                           append_count);
 					append_counts[current_append_idx] += append_count;
 					remaining -= append_count;
@@ -824,7 +853,7 @@ public:
 						current_append_idx++;
 						new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
 						// slice chunk for the next append
-						scan_chunk.Slice(append_count, remaining);
+						append_chunk.Slice(append_count, remaining);
 					}
 				}
 			}
@@ -839,6 +868,12 @@ public:
 
 			// assign the new row group to the current segment
 			checkpoint_state.segments[segment_idx + target_idx].node = std::move(row_group);
+			if (vacuum_state.update_indexes) {
+				// the rows of the target row groups are consecutive in the order in which they were merged
+				auto begin = previous_row_ids.begin() + NumericCast<int64_t>(total_append_count);
+				auto end = begin + NumericCast<int64_t>(append_counts[target_idx]);
+				vacuum_state.previous_row_ids[segment_idx + target_idx].assign(begin, end);
+			}
 			total_append_count += append_counts[target_idx];
 		}
 		if (total_append_count != merge_rows) {
@@ -862,11 +897,16 @@ private:
 void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                                vector<SegmentNode<RowGroup>> &segments) {
 	bool is_full_checkpoint = checkpoint_state.writer.GetCheckpointType() == CheckpointType::FULL_CHECKPOINT;
-	// currently we can only vacuum deletes if we are doing a full checkpoint and there are no indexes
-	state.can_vacuum_deletes = info->GetIndexes().Empty() && is_full_checkpoint;
+	// currently we can only vacuum deletes if we are doing a full checkpoint
+	state.can_vacuum_deletes = is_full_checkpoint && CanVacuumIndexes();
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	state.update_indexes = !info->GetIndexes().Empty();
+	if (state.update_indexes) {
+		state.previous_row_ids.resize(segments.size());
+		state.previous_row_start.resize(segments.size(), DConstants::INVALID_INDEX);
+	}
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -876,11 +916,101 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 			// empty row group - we can drop it entirely
 			row_group.CommitDrop();
 			entry.node.reset();
+			state.row_ids_changed = true;
 		}
 		state.row_group_counts.push_back(row_group_count);
 	}
 }
 
+bool RowGroupCollection::CanVacuumIndexes() {
+	auto &indexes = info->GetIndexes();
+	if (indexes.Empty()) {
+		return true;
+	}
+	// vacuuming changes row ids, after which we move the index entries of the moved rows to their new row ids
+	// deleted rows are only removed from the indexes when the deleting transaction is cleaned up, however
+	// we can only vacuum if every committed transaction has been cleaned up, and no transaction needs older data
+	auto &transaction_manager = DuckTransactionManager::Get(GetAttached());
+	if (transaction_manager.GetLastCommit() >= transaction_manager.LowestActiveStart()) {
+		return false;
+	}
+	// we can only rebuild bound indexes
+	bool all_bound = true;
+	indexes.Scan([&](Index &index) {
+		if (!index.IsBound()) {
+			all_bound = false;
+			return true;
+		}
+		return false;
+	});
+	return all_bound;
+}
+
+//! Moves the index entries of the rows of a row group whose row ids were changed by vacuuming, by either removing the
+//! entries with the previous row ids of the rows or by adding the entries with their current row ids
+static void MoveIndexEntries(TableIndexList &indexes, RowGroup &row_group, const vector<LogicalType> &types,
+                             const unsafe_vector<row_t> &previous_row_ids, idx_t previous_row_start, bool remove) {
+	vector<column_t> column_ids;
+	for (idx_t c = 0; c < types.size(); c++) {
+		column_ids.push_back(c);
+	}
+	column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	auto scan_types = types;
+	scan_types.push_back(LogicalType::ROW_TYPE);
+
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::DefaultAllocator(), scan_types);
+	DataChunk index_chunk;
+	index_chunk.InitializeEmpty(types);
+	Vector row_identifiers(LogicalType::ROW_TYPE);
+	auto row_identifier_data = FlatVector::GetData<row_t>(row_identifiers);
+
+	TableScanState scan_state;
+	scan_state.Initialize(std::move(column_ids));
+	scan_state.table_state.Initialize(types);
+	scan_state.table_state.max_row = idx_t(-1);
+	row_group.InitializeScan(scan_state.table_state);
+	while (true) {
+		scan_chunk.Reset();
+		row_group.ScanCommitted(scan_state.table_state, scan_chunk, TableScanType::TABLE_SCAN_LATEST_COMMITTED_ROWS);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		for (idx_t c = 0; c < types.size(); c++) {
+			index_chunk.data[c].Reference(scan_chunk.data[c]);
+		}
+		index_chunk.SetCardinality(scan_chunk);
+		auto &row_ids = scan_chunk.data[types.size()];
+		row_ids.Flatten(scan_chunk.size());
+		auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+		for (idx_t i = 0; i < scan_chunk.size(); i++) {
+			auto offset = NumericCast<idx_t>(row_id_data[i]) - row_group.start;
+			if (!remove) {
+				row_identifier_data[i] = row_id_data[i];
+			} else if (previous_row_start != DConstants::INVALID_INDEX) {
+				// the row group was moved as a whole - the rows kept their offsets
+				row_identifier_data[i] = NumericCast<row_t>(previous_row_start + offset);
+			} else {
+				// the row group was merged - its rows were appended in order
+				row_identifier_data[i] = previous_row_ids[offset];
+			}
+		}
+		indexes.Scan([&](Index &index) {
+			auto &bound_index = index.Cast<BoundIndex>();
+			if (remove) {
+				bound_index.Delete(index_chunk, row_identifiers);
+				return false;
+			}
+			auto error = bound_index.Append(index_chunk, row_identifiers);
+			if (error.HasError()) {
+				throw InternalException("Failed to move the entries of index \"%s\" after vacuuming deletes: %s",
+				                        index.GetIndexName(), error.Message());
+			}
+			return false;
+		});
+	}
+}
+
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                              idx_t segment_idx) {
 	static constexpr const idx_t MAX_MERGE_COUNT = 3;
@@ -939,6 +1069,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
 	                                         merge_rows, state.row_start);
 	checkpoint_state.executor.ScheduleTask(std::move(vacuum_task));
+	state.row_ids_changed = true;
 	// skip vacuuming by the row groups we have merged
 	state.next_vacuum_idx = next_idx;
 	state.row_start += merge_rows;
@@ -974,6 +1105,9 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 			continue;
 		}
 		// schedule a checkpoint task for this row group
+		if (vacuum_state.update_indexes && entry.node->start != vacuum_state.row_start) {
+			vacuum_state.previous_row_start[segment_idx] = entry.node->start;
+		}
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
 		ScheduleCheckpointTask(checkpoint_state, segment_idx);
 		vacuum_state.row_start += entry.node->count;
@@ -981,6 +1115,32 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	// all tasks have been scheduled - execute tasks until we are done
 	checkpoint_state.executor.WorkOnTasks();
 
+	// if vacuuming moved rows around the row ids stored in the indexes are stale - move the entries of the moved rows
+	// we first remove all stale entries, so the new row ids cannot collide with the row ids of rows that are not moved
+	// yet
+	auto &indexes = info->GetIndexes();
+	auto rows_moved = [&](idx_t segment_idx) {
+		return vacuum_state.update_indexes && segments[segment_idx].node &&
+		       (!vacuum_state.previous_row_ids[segment_idx].empty() ||
+		        vacuum_state.previous_row_start[segment_idx] != DConstants::INVALID_INDEX);
+	};
+	if (vacuum_state.row_ids_changed && vacuum_state.update_indexes) {
+		for (bool remove : {true, false}) {
+			for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
+				if (!rows_moved(segment_idx)) {
+					continue;
+				}
+				MoveIndexEntries(indexes, *segments[segment_idx].node, types,
+				                 vacuum_state.previous_row_ids[segment_idx],
+				                 vacuum_state.previous_row_start[segment_idx], remove);
+			}
+		}
+	}
+	if (vacuum_state.row_ids_changed) {
+		// row ids of index scans that were planned before the vacuum can no longer be used
+		info->IncrementVacuumCount();
+	}
+
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
@@ -1169,4 +1329,38 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+void RowGroupCollection::SetValueDistribution(column_t column_id, unique_ptr<ValueDistribution> distribution) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	stats.GetStats(*stats_lock, column_id).SetValueDistribution(std::move(distribution));
+}
+
+unique_ptr<BlockingSample> RowGroupCollection::SampleRows(idx_t sample_size) {
+	auto sample = make_uniq<ReservoirSample>(GetAllocator(), sample_size);
+	if (total_rows > 0) {
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(GetAllocator(), types);
+
+		CreateIndexScanState state;
+		vector<column_t> column_ids;
+		for (idx_t i = 0; i < types.size(); i++) {
+			column_ids.push_back(i);
+		}
+		state.Initialize(column_ids, nullptr);
+		InitializeScan(state.table_state, column_ids, nullptr);
+		InitializeCreateIndexScan(state);
+		while (true) {
+			scan_chunk.Reset();
+			state.table_state.ScanCommitted(scan_chunk, state.segment_lock,
+			                                TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			sample->AddToReservoir(scan_chunk);
+		}
+	}
+	sample->Finalize();
+	return std::move(sample);
+}
+
 } // namespace duckdb
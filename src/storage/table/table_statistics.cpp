@@ -14,6 +14,7 @@ void TableStatistics::Initialize(const vector<LogicalType> &types, PersistentTab
 	if (column_stats.size() != types.size()) { // LCOV_EXCL_START
 		throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
 	} // LCOV_EXCL_STOP
+	table_sample = std::move(data.table_stats.table_sample);
 }
 
 void TableStatistics::InitializeEmpty(const vector<LogicalType> &types) {
@@ -109,6 +110,14 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	return result.ToUnique();
 }
 
+unique_ptr<ValueDistribution> TableStatistics::CopyValueDistribution(idx_t i) {
+	lock_guard<mutex> l(*stats_lock);
+	if (!column_stats[i]->HasValueDistribution()) {
+		return nullptr;
+	}
+	return column_stats[i]->GetValueDistribution().Copy();
+}
+
 void TableStatistics::CopyStats(TableStatistics &other) {
 	TableStatisticsLock lock(*stats_lock);
 	CopyStats(lock, other);
@@ -120,6 +129,60 @@ void TableStatistics::CopyStats(TableStatisticsLock &lock, TableStatistics &othe
 	for (auto &stats : column_stats) {
 		other.column_stats.push_back(stats->Copy());
 	}
+	other.table_sample = CopyTableSample(lock);
+}
+
+void TableStatistics::CopyTableSample(TableStatistics &other) {
+	TableStatisticsLock lock(*stats_lock);
+	other.SetTableSample(CopyTableSample(lock));
+}
+
+unique_ptr<BlockingSample> TableStatistics::CopyTableSample(TableStatisticsLock &lock) {
+	auto sample_rows = GetTableSample(lock);
+	if (!sample_rows) {
+		return nullptr;
+	}
+	auto result = make_uniq<ReservoirSample>(table_sample->Cast<ReservoirSample>().sample_count);
+	result->reservoir_chunk = make_uniq<ReservoirChunk>();
+	result->reservoir_chunk->chunk.Move(*sample_rows);
+	return std::move(result);
+}
+
+void TableStatistics::SetTableSample(unique_ptr<BlockingSample> sample) {
+	lock_guard<mutex> l(*stats_lock);
+	table_sample = std::move(sample);
+}
+
+bool TableStatistics::HasTableSample(idx_t sample_size) {
+	lock_guard<mutex> l(*stats_lock);
+	if (!table_sample || table_sample->type != SampleType::RESERVOIR_SAMPLE) {
+		return false;
+	}
+	return table_sample->Cast<ReservoirSample>().sample_count == sample_size;
+}
+
+unique_ptr<DataChunk> TableStatistics::GetTableSample() {
+	TableStatisticsLock lock(*stats_lock);
+	return GetTableSample(lock);
+}
+
+unique_ptr<DataChunk> TableStatistics::GetTableSample(TableStatisticsLock &lock) {
+	if (!table_sample || table_sample->type != SampleType::RESERVOIR_SAMPLE) {
+		return nullptr;
+	}
+	auto &sample = table_sample->Cast<ReservoirSample>();
+	if (!sample.reservoir_chunk || sample.reservoir_chunk->chunk.size() == 0) {
+		return nullptr;
+	}
+	auto &rows = sample.reservoir_chunk->chunk;
+	if (rows.ColumnCount() != column_stats.size()) {
+		// the sample was taken before the columns of the table were altered
+		return nullptr;
+	}
+	auto result = make_uniq<DataChunk>();
+	result->Initialize(Allocator::DefaultAllocator(), rows.GetTypes(), rows.size());
+	rows.Copy(*result);
+	return result;
 }
 
 void TableStatistics::Serialize(Serializer &serializer) const {
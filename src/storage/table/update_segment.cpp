@@ -98,14 +98,22 @@ static void UpdateMergeValidity(transaction_t start_time, transaction_t transact
 	                                  [&](UpdateInfo *current) { MergeValidityInfo(current, result_mask); });
 }
 
+//! Whether or not the (sorted, unique) tuples in the range [start, end) form a consecutive run of row indexes
+static bool IsConsecutiveRun(const sel_t *tuples, idx_t start, idx_t end) {
+	D_ASSERT(end > start);
+	return idx_t(tuples[end - 1] - tuples[start]) == end - start - 1;
+}
+
 template <class T>
 static void MergeUpdateInfo(UpdateInfo *current, T *result_data) {
 	auto info_data = reinterpret_cast<T *>(current->tuple_data);
-	if (current->N == STANDARD_VECTOR_SIZE) {
-		// special case: update touches ALL tuples of this vector
+	if (current->N == 0) {
+		return;
+	}
+	if (IsConsecutiveRun(current->tuples, 0, current->N)) {
+		// special case: update touches a consecutive range of tuples of this vector (e.g. ALL tuples)
 		// in this case we can just memcpy the data
-		// since the layout of the update info is guaranteed to be [0, 1, 2, 3, ...]
-		memcpy(result_data, info_data, sizeof(T) * current->N);
+		memcpy(result_data + current->tuples[0], info_data, sizeof(T) * current->N);
 	} else {
 		for (idx_t i = 0; i < current->N; i++) {
 			result_data[current->tuples[i]] = info_data[i];
@@ -266,14 +274,23 @@ static void FetchCommittedRangeValidity(UpdateInfo *info, idx_t start, idx_t end
 template <class T>
 static void MergeUpdateInfoRange(UpdateInfo *current, idx_t start, idx_t end, idx_t result_offset, T *result_data) {
 	auto info_data = reinterpret_cast<T *>(current->tuple_data);
-	for (idx_t i = 0; i < current->N; i++) {
-		auto tuple_idx = current->tuples[i];
-		if (tuple_idx < start) {
-			continue;
-		} else if (tuple_idx >= end) {
-			break;
-		}
-		auto result_idx = result_offset + tuple_idx - start;
+	// the tuples are sorted: binary search for the updates that fall within [start, end)
+	auto tuples_end = current->tuples + current->N;
+	auto range_start = std::lower_bound(current->tuples, tuples_end, start);
+	auto range_end = std::lower_bound(range_start, tuples_end, end);
+	auto start_idx = NumericCast<idx_t>(range_start - current->tuples);
+	auto end_idx = NumericCast<idx_t>(range_end - current->tuples);
+	if (start_idx == end_idx) {
+		return;
+	}
+	if (IsConsecutiveRun(current->tuples, start_idx, end_idx)) {
+		// the updates in this range touch consecutive tuples: memcpy the data
+		auto result_idx = result_offset + current->tuples[start_idx] - start;
+		memcpy(result_data + result_idx, info_data + start_idx, sizeof(T) * (end_idx - start_idx));
+		return;
+	}
+	for (idx_t i = start_idx; i < end_idx; i++) {
+		auto result_idx = result_offset + current->tuples[i] - start;
 		result_data[result_idx] = info_data[i];
 	}
 }
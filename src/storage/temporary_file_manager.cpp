@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "miniz.hpp"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +98,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+      slot_size(slot_size),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +121,47 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (!compressed_buffer.IsSet()) {
+		D_ASSERT(slot_size == BufferManager::GetBufferManager(db).GetBlockAllocSize());
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// the compressed buffer starts with the size of the compressed data
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+	handle->Write(compressed_buffer.get(), sizeof(idx_t) + compressed_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (slot_size == buffer_manager.GetBlockAllocSize()) {
+		// uncompressed block
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, GetPositionInFile(block_index),
+		                                                          buffer_manager.GetBlockSize(),
+		                                                          std::move(reusable_buffer));
+	}
+
+	// compressed block: read the compressed size, followed by the compressed data
+	auto position = GetPositionInFile(block_index);
+	idx_t compressed_size;
+	handle->Read(&compressed_size, sizeof(idx_t), position);
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+	auto compressed_buffer = Allocator::Get(db).Allocate(compressed_size);
+	handle->Read(compressed_buffer.get(), compressed_size, position + sizeof(idx_t));
+
+	// decompress into the buffer
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_miniz::tinfl_decompress_mem_to_mem(buffer->InternalBuffer(), buffer->AllocSize(),
+	                                                                   compressed_buffer.get(), compressed_size, 0);
+	if (decompressed_size != buffer->AllocSize()) {
+		throw IOException("Failed to decompress temporary buffer from \"%s\"", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +215,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -267,7 +301,8 @@ static idx_t GetDefaultMax(const string &path) {
 }
 
 TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p)
-    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0) {
+    : db(db), temp_directory(temp_directory_p), size_on_disk(0), max_swap_space(0), compression_skip_count(0),
+      compression_backoff(0) {
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
@@ -277,17 +312,80 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+bool TemporaryFileManager::ShouldCompress() {
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return false;
+	}
+	// races on the counter are harmless: we only use it to estimate how often compression pays off
+	if (compression_skip_count.load(std::memory_order_relaxed) == 0) {
+		return true;
+	}
+	compression_skip_count.fetch_sub(1, std::memory_order_relaxed);
+	return false;
+}
+
+void TemporaryFileManager::UpdateCompressionBackoff(bool compressed) {
+	if (compressed) {
+		compression_backoff.store(0, std::memory_order_relaxed);
+		return;
+	}
+	// the data did not compress well, skip compressing the next blocks (exponentially more on repeated failures)
+	auto backoff = MinValue<idx_t>(MaxValue<idx_t>(compression_backoff.load(std::memory_order_relaxed) * 2, 1),
+	                               MAX_COMPRESSION_BACKOFF);
+	compression_backoff.store(backoff, std::memory_order_relaxed);
+	compression_skip_count.store(backoff, std::memory_order_relaxed);
+}
+
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	D_ASSERT(buffer.AllocSize() == block_alloc_size);
+	if (!ShouldCompress()) {
+		return block_alloc_size;
+	}
+
+	// the compressed data must fit into the largest slot size smaller than the block allocation size
+	auto slot_size_step = block_alloc_size / SLOT_SIZE_CLASSES;
+	auto max_compressed_size = block_alloc_size - slot_size_step - sizeof(idx_t);
+	compressed_buffer = Allocator::Get(db).Allocate(block_alloc_size - slot_size_step);
+	// we use the fastest compression level, as spilling should not become CPU-bound
+	auto flags = duckdb_miniz::tdefl_create_comp_flags_from_zip_params(
+	    duckdb_miniz::MZ_BEST_SPEED, -MZ_DEFAULT_WINDOW_BITS, duckdb_miniz::MZ_DEFAULT_STRATEGY);
+	auto compressed_size =
+	    duckdb_miniz::tdefl_compress_mem_to_mem(compressed_buffer.get() + sizeof(idx_t), max_compressed_size,
+	                                            buffer.InternalBuffer(), buffer.AllocSize(), NumericCast<int>(flags));
+	if (compressed_size == 0) {
+		// the compressed data does not fit: write the block uncompressed
+		compressed_buffer.Reset();
+		UpdateCompressionBackoff(false);
+		return block_alloc_size;
+	}
+	UpdateCompressionBackoff(true);
+	Store<idx_t>(compressed_size, compressed_buffer.get());
+	// round up to the next slot size
+	auto required_size = sizeof(idx_t) + compressed_size;
+	return (required_size + slot_size_step - 1) / slot_size_step * slot_size_step;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	// compress the buffer (if enabled) before grabbing the lock
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the same slot size
+		idx_t slot_size_file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
+			slot_size_file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +395,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file = make_uniq<TemporaryFileHandle>(slot_size_file_count, db, temp_directory, new_file_index,
+			                                               *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +407,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
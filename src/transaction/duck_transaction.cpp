@@ -152,6 +152,42 @@ void DuckTransaction::UpdateCollection(shared_ptr<RowGroupCollection> &collectio
 	updated_collections.insert(make_pair(collection_ref, collection));
 }
 
+void DuckTransaction::ModifyTable(DataTable &table) {
+	lock_guard<mutex> l(modified_tables_lock);
+	modified_tables.insert(table);
+}
+
+bool DuckTransaction::IsModifiedTable(DataTable &table) {
+	lock_guard<mutex> l(modified_tables_lock);
+	return modified_tables.find(table) != modified_tables.end();
+}
+
+vector<reference<DataTable>> DuckTransaction::GetModifiedTables() {
+	lock_guard<mutex> l(modified_tables_lock);
+	vector<reference<DataTable>> result;
+	for (auto &table : modified_tables) {
+		result.push_back(table);
+	}
+	return result;
+}
+
+vector<row_t> DuckTransaction::GetModifiedRows(DataTable &table) {
+	return undo_buffer.GetModifiedRows(table);
+}
+
+void DuckTransaction::RequireUnchangedTable(DataTable &table) {
+	lock_guard<mutex> l(modified_tables_lock);
+	unchanged_tables.push_back(table.GetDataTableInfo());
+}
+
+void DuckTransaction::CollectChangedTables() {
+	// the tables in which rows were inserted, deleted or updated
+	changed_tables = storage->GetTables();
+	for (auto &table : GetModifiedTables()) {
+		changed_tables.push_back(table);
+	}
+}
+
 bool DuckTransaction::ChangesMade() {
 	return undo_buffer.ChangesMade() || storage->ChangesMade();
 }
@@ -196,6 +232,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 		auto &storage_manager = db.GetStorageManager();
 		auto log = storage_manager.GetWAL();
 		commit_state = storage_manager.GenStorageCommitState(*log);
+		CollectChangedTables();
 		storage->Commit(commit_state.get());
 		undo_buffer.WriteToWAL(*log, commit_state.get());
 		if (commit_state->HasRowGroupData()) {
@@ -226,15 +263,28 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		return ErrorData();
 	}
 	D_ASSERT(db.IsSystem() || db.IsTemporary() || !IsReadOnly());
+	for (auto &info : unchanged_tables) {
+		if (info->GetCommitVersion() > start_time) {
+			return ErrorData(TransactionException("Conflict on table \"%s\": it was changed by a concurrent transaction",
+			                                      info->GetTableName()));
+		}
+	}
 
 	UndoBuffer::IteratorState iterator_state;
 	try {
+		if (!commit_state) {
+			// the local storage was not committed yet by writing the changes to the WAL
+			CollectChangedTables();
+		}
 		storage->Commit(commit_state.get());
 		undo_buffer.Commit(iterator_state, commit_id);
 		if (commit_state) {
 			// if we have written to the WAL - flush after the commit has been successful
 			commit_state->FlushCommit();
 		}
+		for (auto &table : changed_tables) {
+			table.get().GetDataTableInfo()->SetCommitVersion(commit_id);
+		}
 		return ErrorData();
 	} catch (std::exception &ex) {
 		undo_buffer.RevertCommit(iterator_state, this->transaction_id);
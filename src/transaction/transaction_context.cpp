@@ -6,6 +6,7 @@
 #include "duckdb/main/client_context_state.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/materialized_view.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -41,6 +42,17 @@ void TransactionContext::Commit() {
 	if (!current_transaction) {
 		throw TransactionException("failed to commit: no transaction active");
 	}
+	auto modified_database = current_transaction->ModifiedDatabase();
+	if (modified_database) {
+		// bring the materialized views up to date with the changes of the transaction before committing them
+		try {
+			MaterializedView::MaintainViews(context, *modified_database);
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			Rollback(error);
+			throw TransactionException("Failed to commit: %s", error.RawMessage());
+		}
+	}
 	auto transaction = std::move(current_transaction);
 	ClearTransaction();
 	auto error = transaction->Commit();
@@ -3,9 +3,12 @@
 #include "duckdb/catalog/catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
 #include "duckdb/catalog/catalog_entry/list.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/cleanup_state.hpp"
 #include "duckdb/transaction/commit_state.hpp"
@@ -13,6 +16,7 @@
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/transaction/wal_write_state.hpp"
 #include "duckdb/transaction/delete_info.hpp"
+#include "duckdb/transaction/update_info.hpp"
 
 namespace duckdb {
 constexpr uint32_t UNDO_ENTRY_HEADER_SIZE = sizeof(UndoFlags) + sizeof(uint32_t);
@@ -158,6 +162,45 @@ UndoBufferProperties UndoBuffer::GetProperties() {
 	return properties;
 }
 
+vector<row_t> UndoBuffer::GetModifiedRows(DataTable &table) {
+	vector<row_t> result;
+	auto &table_info = *table.GetDataTableInfo();
+	IteratorState iterator_state;
+	IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) {
+		switch (type) {
+		case UndoFlags::DELETE_TUPLE: {
+			auto info = reinterpret_cast<DeleteInfo *>(data);
+			if (info->table->GetDataTableInfo().get() != &table_info) {
+				break;
+			}
+			for (idx_t i = 0; i < info->count; i++) {
+				auto row = info->is_consecutive ? i : info->GetRows()[i];
+				result.push_back(UnsafeNumericCast<row_t>(info->base_row + row));
+			}
+			break;
+		}
+		case UndoFlags::UPDATE_TUPLE: {
+			auto info = reinterpret_cast<UpdateInfo *>(data);
+			auto &column_data = info->segment->column_data;
+			if (&column_data.GetTableInfo() != &table_info) {
+				break;
+			}
+			auto start = column_data.start + info->vector_index * STANDARD_VECTOR_SIZE;
+			for (idx_t i = 0; i < info->N; i++) {
+				result.push_back(UnsafeNumericCast<row_t>(start + info->tuples[i]));
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	});
+	// rows can be updated in several columns, or be updated and deleted
+	std::sort(result.begin(), result.end());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+	return result;
+}
+
 void UndoBuffer::Cleanup(transaction_t lowest_active_transaction) {
 	// garbage collect everything in the Undo Chunk
 	// this should only happen if
@@ -47,6 +47,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"cardinality_feedback_threshold", {Value::DOUBLE(4)}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -82,6 +83,8 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"max_temp_directory_size", {"10.0 GiB"}},
 	    {"merge_join_threshold", {73}},
 	    {"nested_loop_join_threshold", {73}},
+	    {"object_cache_memory_limit", {"64.0 MiB"}},
+	    {"query_result_cache_memory_limit", {"64.0 MiB"}},
 	    {"memory_limit", {"4.0 GiB"}},
 	    {"storage_compatibility_version", {"v0.10.0"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
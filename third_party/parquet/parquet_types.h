@@ -1615,12 +1615,14 @@ void swap(PageEncodingStats &a, PageEncodingStats &b);
 std::ostream& operator<<(std::ostream& out, const PageEncodingStats& obj);
 
 typedef struct _ColumnMetaData__isset {
-  _ColumnMetaData__isset() : key_value_metadata(false), index_page_offset(false), dictionary_page_offset(false), statistics(false), encoding_stats(false) {}
+  _ColumnMetaData__isset() : key_value_metadata(false), index_page_offset(false), dictionary_page_offset(false), statistics(false), encoding_stats(false), bloom_filter_offset(false), bloom_filter_length(false) {}
   bool key_value_metadata :1;
   bool index_page_offset :1;
   bool dictionary_page_offset :1;
   bool statistics :1;
   bool encoding_stats :1;
+  bool bloom_filter_offset :1;
+  bool bloom_filter_length :1;
 } _ColumnMetaData__isset;
 
 class ColumnMetaData : public virtual ::duckdb_apache::thrift::TBase {
@@ -1628,7 +1630,7 @@ class ColumnMetaData : public virtual ::duckdb_apache::thrift::TBase {
 
   ColumnMetaData(const ColumnMetaData&);
   ColumnMetaData& operator=(const ColumnMetaData&);
-  ColumnMetaData() : type((Type::type)0), codec((CompressionCodec::type)0), num_values(0), total_uncompressed_size(0), total_compressed_size(0), data_page_offset(0), index_page_offset(0), dictionary_page_offset(0) {
+  ColumnMetaData() : type((Type::type)0), codec((CompressionCodec::type)0), num_values(0), total_uncompressed_size(0), total_compressed_size(0), data_page_offset(0), index_page_offset(0), dictionary_page_offset(0), bloom_filter_offset(0), bloom_filter_length(0) {
   }
 
   virtual ~ColumnMetaData() throw();
@@ -1645,6 +1647,8 @@ class ColumnMetaData : public virtual ::duckdb_apache::thrift::TBase {
   int64_t dictionary_page_offset;
   Statistics statistics;
   duckdb::vector<PageEncodingStats>  encoding_stats;
+  int64_t bloom_filter_offset;
+  int32_t bloom_filter_length;
 
   _ColumnMetaData__isset __isset;
 
@@ -1674,6 +1678,10 @@ class ColumnMetaData : public virtual ::duckdb_apache::thrift::TBase {
 
   void __set_encoding_stats(const duckdb::vector<PageEncodingStats> & val);
 
+  void __set_bloom_filter_offset(const int64_t val);
+
+  void __set_bloom_filter_length(const int32_t val);
+
   bool operator == (const ColumnMetaData & rhs) const
   {
     if (!(type == rhs.type))
@@ -1712,6 +1720,14 @@ class ColumnMetaData : public virtual ::duckdb_apache::thrift::TBase {
       return false;
     else if (__isset.encoding_stats && !(encoding_stats == rhs.encoding_stats))
       return false;
+    if (__isset.bloom_filter_offset != rhs.__isset.bloom_filter_offset)
+      return false;
+    else if (__isset.bloom_filter_offset && !(bloom_filter_offset == rhs.bloom_filter_offset))
+      return false;
+    if (__isset.bloom_filter_length != rhs.__isset.bloom_filter_length)
+      return false;
+    else if (__isset.bloom_filter_length && !(bloom_filter_length == rhs.bloom_filter_length))
+      return false;
     return true;
   }
   bool operator != (const ColumnMetaData &rhs) const {